@@ -0,0 +1,969 @@
+/**
+ * @file: bench.c
+ * @author: CrookedPoe (https://github.com/CrookedPoe)
+ * 
+ * @brief Microbenchmarks for every public libaxis kernel.
+ * 
+ * Built and run by `make bench`. Unlike the library this links against the
+ * host C library for timing and output, so only headers that do not collide
+ * with lainttypes.h are included ahead of libaxis.h.
+ * 
+ * usage: libaxis_bench [--filter SUBSTRING] [--min-ms MS] [--json FILE|-] [--base]
+ *
+ * --base times the dispatched batch kernels as built, instead of the set
+ * LibAxis_Dispatch_Init picks for this host.
+**/
+
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <pthread.h>
+#include <sched.h>
+#include "libaxis.h"
+
+#define BENCH_MAX_CASES 1024
+#define POOL 256
+#define MASK (POOL - 1)
+#define MPOOL 64
+#define BATCH 1024
+#define JOB_CHECK_WORKERS 4
+#define JOB_CHECK_RUNS 2000
+#define TEX 64
+
+typedef struct {
+    const char* name;
+    const char* mode;
+    uint32_t elems;
+    void (*fn)(uint32_t iters);
+} BenchCase;
+
+typedef struct {
+    const BenchCase* bench;
+    double ns_per_op;
+    double ops_per_sec;
+} BenchResult;
+
+static BenchCase bench_cases[BENCH_MAX_CASES];
+static uint32_t bench_count;
+static uint32_t bench_dropped;
+
+/* Constructors cannot stop the program, so cases past the table are counted and main refuses to run. */
+static void Bench_Register(const char* name, const char* mode, uint32_t elems, void (*fn)(uint32_t)) {
+    if (bench_count >= BENCH_MAX_CASES) {
+        bench_dropped++;
+        return;
+    }
+
+    bench_cases[bench_count].name = name;
+    bench_cases[bench_count].mode = mode;
+    bench_cases[bench_count].elems = elems;
+    bench_cases[bench_count].fn = fn;
+    bench_count++;
+}
+
+/*
+ * BENCH_SINGLE times one call per iteration, BENCH_BATCH times one call that
+ * processes ELEMS elements. Both register themselves before main() runs. The
+ * body (the trailing arguments, so it may contain commas) sees `i`, the
+ * iteration, and `k`, an index into the input pools.
+ */
+#define BENCH_CASE(ID, LABEL, MODE, ELEMS, ...)                             \
+    static void bench_##ID(uint32_t iters) {                                \
+        uint32_t i, k;                                                      \
+        for (i = 0; i < iters; i++) {                                       \
+            k = i & MASK;                                                   \
+            (void)k;                                                        \
+            __VA_ARGS__;                                                    \
+        }                                                                   \
+    }                                                                       \
+    __attribute__((constructor)) static void bench_register_##ID(void) {   \
+        Bench_Register(LABEL, MODE, ELEMS, bench_##ID);                     \
+    }
+
+#define BENCH_SINGLE(ID, ...)                    BENCH_CASE(ID, #ID, "single", 1, __VA_ARGS__)
+#define BENCH_SINGLE_NAMED(ID, LABEL, ...)       BENCH_CASE(ID, LABEL, "single", 1, __VA_ARGS__)
+#define BENCH_BATCH(ID, ELEMS, ...)              BENCH_CASE(ID, #ID, "batch", ELEMS, __VA_ARGS__)
+#define BENCH_BATCH_NAMED(ID, LABEL, ELEMS, ...) BENCH_CASE(ID, LABEL, "batch", ELEMS, __VA_ARGS__)
+
+/* Results are written to these so the calls cannot be discarded. */
+static volatile float sink_f;
+static volatile int32_t sink_i;
+
+/* Input and output pools */
+#define DECLARE_POOL(T) static T a_##T[POOL], b_##T[POOL], o_##T[POOL];
+DECLARE_POOL(Vec2f) DECLARE_POOL(Vec2i) DECLARE_POOL(Vec2s)
+DECLARE_POOL(Vec3f) DECLARE_POOL(Vec3i) DECLARE_POOL(Vec3s)
+DECLARE_POOL(Vec4f) DECLARE_POOL(Vec4i) DECLARE_POOL(Vec4s)
+
+static float a_f[POOL], b_f[POOL], o_f[POOL];
+static int32_t a_i[POOL], b_i[POOL];
+static uint8_t a_u8[POOL * 3];
+static uint32_t a_u32[POOL], b_u32[POOL];
+static float ma[MPOOL][4][4], mb[MPOOL][4][4], mo[MPOOL][4][4], mr[MPOOL][4][4];
+static Color_HSVf hsv_pool[POOL];
+static float hsv_plane[3][POOL];
+static uint8_t rgb_plane[3][POOL];
+static float m43a[MPOOL][4][3], m43b[MPOOL][4][3], m43o[MPOOL][4][3];
+static Mtx44 mfx[MPOOL];
+static float batch_in[BATCH], batch_out[BATCH], batch_out2[BATCH];
+static uint8_t tex_rgba32[TEX * TEX * 4], tex_rgba16[TEX * TEX * 2], tex_rgb24[TEX * TEX * 3], tex_small[TEX * TEX];
+static float stream_buf[3][VEC4F_STREAM_FLOATS(BATCH)] LA_ALIGN(LA_STREAM_ALIGN);
+static QuatF quat_a[BATCH], quat_b[BATCH], quat_o[BATCH];
+static float pose_buf[3][LA_POSE_FLOATS(MPOOL)];
+static Pose pose_a, pose_b, pose_o;
+static int32_t pose_parents[MPOOL];
+static uint8_t tree_buf[LA_TRANSFORM_BYTES(BATCH)] LA_ALIGN(16);
+static TransformTree tree;
+static float cull_buf[3][VEC3F_STREAM_FLOATS(BATCH)] LA_ALIGN(LA_STREAM_ALIGN);
+static float cull_radius[BATCH];
+static uint32_t cull_visible[BATCH];
+static uint8_t bvh_buf[3][LA_BVH_BYTES(BATCH)] LA_ALIGN(64);
+static uint8_t grid_buf[2][LA_HASHGRID_BYTES(BATCH)] LA_ALIGN(16);
+static Vec3f grid_points[BATCH];
+static uint32_t grid_pairs[BATCH * 32];
+static Vec3f bvh_tri[BATCH * 3], bvh_min[BATCH], bvh_max[BATCH], bvh_point[POOL], bvh_dir[POOL];
+static float ray_buf[2][VEC3F_STREAM_FLOATS(BATCH)] LA_ALIGN(LA_STREAM_ALIGN);
+static float ray_hit_buf[LA_RAY_HIT_FLOATS(BATCH)] LA_ALIGN(LA_STREAM_ALIGN);
+static Vec3f ray_origin[BATCH], ray_dir[BATCH];
+static uint8_t mstack_buf[LA_MATRIXSTACK_BYTES(16)] LA_ALIGN(16);
+static MatrixStack mstack;
+static uint8_t arena_buf[1 << 16];
+static Arena arena;
+static JobQueue job_queues[JOB_CHECK_WORKERS] LA_ALIGN(64);
+static JobSystem jobs;
+static Vec3f job_out[BATCH];
+
+typedef struct {
+    uint32_t hits[BATCH];
+    uint32_t count;
+    uint32_t chunk;
+    uint32_t bad;
+} JobCheck;
+
+static JobCheck job_check[2];
+
+static uint32_t rng_state = 0x2545F491;
+
+static float Bench_Random(float lo, float hi) {
+    rng_state = rng_state * 1664525u + 1013904223u;
+    return lo + (hi - lo) * ((rng_state >> 8) * (1.0f / 16777216.0f));
+}
+
+#define FILL_POOL(T, S, LO, HI)                                             \
+    do {                                                                    \
+        S* pa = (S*)a_##T; S* pb = (S*)b_##T;                               \
+        uint32_t n;                                                         \
+        for (n = 0; n < sizeof(a_##T) / (sizeof(S)); n++) {                 \
+            pa[n] = (S)Bench_Random((LO), (HI));                            \
+            pb[n] = (S)Bench_Random((LO), (HI));                            \
+        }                                                                   \
+    } while (0)
+
+static void Bench_Setup(void) {
+    uint32_t n, r, c;
+
+    FILL_POOL(Vec2f, float, 0.5f, 2.0f);
+    FILL_POOL(Vec3f, float, 0.5f, 2.0f);
+    FILL_POOL(Vec4f, float, 0.5f, 2.0f);
+    FILL_POOL(Vec2i, int32_t, 1.0f, 100.0f);
+    FILL_POOL(Vec3i, int32_t, 1.0f, 100.0f);
+    FILL_POOL(Vec4i, int32_t, 1.0f, 100.0f);
+    FILL_POOL(Vec2s, int16_t, 1.0f, 50.0f);
+    FILL_POOL(Vec3s, int16_t, 1.0f, 50.0f);
+    FILL_POOL(Vec4s, int16_t, 1.0f, 50.0f);
+
+    for (n = 0; n < POOL; n++) {
+        a_f[n] = Bench_Random(0.1f, 6.0f);
+        b_f[n] = Bench_Random(1.0f, 3.0f);
+        a_i[n] = (int32_t)Bench_Random(-100.0f, 100.0f);
+        b_i[n] = (int32_t)Bench_Random(0.0f, 8.0f);
+        a_u32[n] = rng_state = rng_state * 1664525u + 1013904223u;
+        b_u32[n] = rng_state = rng_state * 1664525u + 1013904223u;
+    }
+
+    for (n = 0; n < POOL * 3; n++)
+        a_u8[n] = (uint8_t)Bench_Random(0.0f, 255.0f);
+
+    LibAxis_Color_RGBA32ToHSVArray(hsv_pool, (Color_RGBA32*)a_u32, POOL);
+    for (n = 0; n < POOL; n++) {
+        hsv_plane[0][n] = hsv_pool[n].h;
+        hsv_plane[1][n] = hsv_pool[n].s;
+        hsv_plane[2][n] = hsv_pool[n].v;
+    }
+
+    for (n = 0; n < MPOOL; n++) {
+        for (r = 0; r < 4; r++) {
+            for (c = 0; c < 4; c++) {
+                ma[n][r][c] = Bench_Random(-2.0f, 2.0f);
+                mb[n][r][c] = Bench_Random(-2.0f, 2.0f);
+            }
+        }
+
+        /* Rigid-body transforms for the affine/rigid inverse cases. */
+        LibAxis_Matrix44_RotateF(mr[n], Bench_Random(-180.0f, 180.0f), Bench_Random(-90.0f, 90.0f), Bench_Random(-180.0f, 180.0f));
+        mr[n][3][0] = Bench_Random(-100.0f, 100.0f);
+        mr[n][3][1] = Bench_Random(-100.0f, 100.0f);
+        mr[n][3][2] = Bench_Random(-100.0f, 100.0f);
+        LibAxis_Matrix44ToMatrix43F(mr[n], m43a[n]);
+        LibAxis_Matrix44ToMatrix43F(ma[n], m43b[n]);
+    }
+
+    LibAxis_Pose_Init(&pose_a, pose_buf[0], MPOOL);
+    LibAxis_Pose_Init(&pose_b, pose_buf[1], MPOOL);
+    LibAxis_Pose_Init(&pose_o, pose_buf[2], MPOOL);
+    for (n = 0; n < MPOOL; n++) {
+        pose_parents[n] = (n == 0) ? LA_POSE_ROOT : (int32_t)((n - 1) / 2);
+        pose_a.translation[n] = a_Vec3f[n];
+        pose_b.translation[n] = b_Vec3f[n];
+        pose_a.scale[n] = pose_b.scale[n] = VEC3F_NEW(1.0f, 1.0f, 1.0f);
+    }
+
+    for (n = 0; n < BATCH; n++) {
+        batch_in[n] = Bench_Random(0.01f, 100.0f);
+        quat_a[n] = Vec4f_Normalize(VEC4F_NEW(Bench_Random(-1.0f, 1.0f), Bench_Random(-1.0f, 1.0f), Bench_Random(-1.0f, 1.0f), Bench_Random(-1.0f, 1.0f)));
+        quat_b[n] = Vec4f_Normalize(VEC4F_NEW(Bench_Random(-1.0f, 1.0f), Bench_Random(-1.0f, 1.0f), Bench_Random(-1.0f, 1.0f), Bench_Random(-1.0f, 1.0f)));
+    }
+
+    for (n = 0; n < MPOOL; n++) {
+        pose_a.rotation[n] = quat_a[n];
+        pose_b.rotation[n] = quat_b[n];
+    }
+
+    for (n = 0; n < sizeof(tex_rgba32); n++)
+        tex_rgba32[n] = (uint8_t)Bench_Random(0.0f, 255.0f);
+    LibAxis_Texture_Convert(tex_rgba16, LA_TEXFMT_RGBA16, tex_rgba32, LA_TEXFMT_RGBA32, TEX, TEX, 0);
+    LibAxis_Texture_Convert(tex_rgb24, LA_TEXFMT_RGB24, tex_rgba32, LA_TEXFMT_RGBA32, TEX, TEX, 0);
+}
+
+/* ---- vector.c --------------------------------------------------------- */
+
+#define BENCH_VEC_COMMON(T, S)                                                                                  \
+    BENCH_SINGLE(T##_AddAssignment, { T t = a_##T[k]; T##_AddAssignment(&t, &b_##T[k]); o_##T[k] = t; })       \
+    BENCH_SINGLE(T##_SubAssignment, { T t = a_##T[k]; T##_SubAssignment(&t, &b_##T[k]); o_##T[k] = t; })       \
+    BENCH_SINGLE(T##_MultiplyAssignment, { T t = a_##T[k]; T##_MultiplyAssignment(&t, &b_##T[k]); o_##T[k] = t; }) \
+    BENCH_SINGLE(T##_DivideAssignment, { T t = a_##T[k]; T##_DivideAssignment(&t, &b_##T[k]); o_##T[k] = t; }) \
+    BENCH_SINGLE(T##_MultiplyAssignmentF, { T t = a_##T[k]; T##_MultiplyAssignmentF(&t, (S)3); o_##T[k] = t; }) \
+    BENCH_SINGLE(T##_DivideAssignmentF, { T t = a_##T[k]; T##_DivideAssignmentF(&t, (S)3); o_##T[k] = t; })     \
+    BENCH_SINGLE(T##_Add, { o_##T[k] = T##_Add(a_##T[k], b_##T[k]); })                                          \
+    BENCH_SINGLE(T##_Sub, { o_##T[k] = T##_Sub(a_##T[k], b_##T[k]); })                                          \
+    BENCH_SINGLE(T##_Multiply, { o_##T[k] = T##_Multiply(a_##T[k], b_##T[k]); })                                \
+    BENCH_SINGLE(T##_Divide, { o_##T[k] = T##_Divide(a_##T[k], b_##T[k]); })                                    \
+    BENCH_SINGLE(T##_MultiplyF, { o_##T[k] = T##_MultiplyF(a_##T[k], (S)3); })                                   \
+    BENCH_SINGLE(T##_DivideF, { o_##T[k] = T##_DivideF(a_##T[k], (S)3); })                                       \
+    BENCH_SINGLE(T##_Dot, { sink_f = T##_Dot(&a_##T[k], &b_##T[k]); })                                          \
+    BENCH_SINGLE(T##_SquareMagnitude, { sink_f = T##_SquareMagnitude(a_##T[k]); })                               \
+    BENCH_SINGLE(T##_SquareMagnitudePtr, { sink_f = T##_SquareMagnitudePtr(&a_##T[k]); })                        \
+    BENCH_SINGLE(T##_MagnitudePtr, { sink_f = T##_MagnitudePtr(&a_##T[k]); })                                    \
+    BENCH_SINGLE(T##_NormalizeAssignment, { T t = a_##T[k]; T##_NormalizeAssignment(&t); o_##T[k] = t; })      \
+    BENCH_SINGLE(T##_Normalize, { o_##T[k] = T##_Normalize(a_##T[k]); })                                        \
+    BENCH_SINGLE(T##_Distance, { sink_f = T##_Distance(a_##T[k], b_##T[k]); })                                  \
+    BENCH_SINGLE(T##_InverseAssignment, { T t = a_##T[k]; T##_InverseAssignment(&t); o_##T[k] = t; })          \
+    BENCH_SINGLE(T##_Inverse, { o_##T[k] = T##_Inverse(a_##T[k]); })
+
+#define BENCH_VEC_MAGNITUDE(T) \
+    BENCH_SINGLE(T##_Magnitude, { sink_f = T##_Magnitude(a_##T[k]); })
+
+#define BENCH_VEC_CROSS(T) \
+    BENCH_SINGLE(T##_Cross, { o_##T[k] = T##_Cross(&a_##T[k], &b_##T[k]); })
+
+#define BENCH_VEC_FROM(T, U)                                                                                    \
+    BENCH_SINGLE(T##_From##U##Assignment, { T t; T##_From##U##Assignment(&t, &a_##U[k]); o_##T[k] = t; })      \
+    BENCH_SINGLE(T##_From##U, { o_##T[k] = T##_From##U(&a_##U[k]); })
+
+BENCH_VEC_COMMON(Vec2f, float) BENCH_VEC_MAGNITUDE(Vec2f) BENCH_VEC_FROM(Vec2f, Vec2i) BENCH_VEC_FROM(Vec2f, Vec2s)
+BENCH_VEC_COMMON(Vec2i, int32_t) BENCH_VEC_MAGNITUDE(Vec2i) BENCH_VEC_FROM(Vec2i, Vec2f) BENCH_VEC_FROM(Vec2i, Vec2s)
+BENCH_VEC_COMMON(Vec2s, int16_t) BENCH_VEC_MAGNITUDE(Vec2s) BENCH_VEC_FROM(Vec2s, Vec2f) BENCH_VEC_FROM(Vec2s, Vec2i)
+BENCH_VEC_COMMON(Vec3f, float) BENCH_VEC_MAGNITUDE(Vec3f) BENCH_VEC_CROSS(Vec3f) BENCH_VEC_FROM(Vec3f, Vec3i) BENCH_VEC_FROM(Vec3f, Vec3s)
+BENCH_VEC_COMMON(Vec3i, int32_t) BENCH_VEC_MAGNITUDE(Vec3i) BENCH_VEC_CROSS(Vec3i) BENCH_VEC_FROM(Vec3i, Vec3f) BENCH_VEC_FROM(Vec3i, Vec3s)
+BENCH_VEC_COMMON(Vec3s, int16_t) BENCH_VEC_MAGNITUDE(Vec3s) BENCH_VEC_CROSS(Vec3s) BENCH_VEC_FROM(Vec3s, Vec3f) BENCH_VEC_FROM(Vec3s, Vec3i)
+BENCH_VEC_COMMON(Vec4f, float) BENCH_VEC_CROSS(Vec4f) BENCH_VEC_FROM(Vec4f, Vec4i) BENCH_VEC_FROM(Vec4f, Vec4s)
+BENCH_VEC_COMMON(Vec4i, int32_t) BENCH_VEC_MAGNITUDE(Vec4i) BENCH_VEC_CROSS(Vec4i) BENCH_VEC_FROM(Vec4i, Vec4f) BENCH_VEC_FROM(Vec4i, Vec4s)
+BENCH_VEC_COMMON(Vec4s, int16_t) BENCH_VEC_MAGNITUDE(Vec4s) BENCH_VEC_CROSS(Vec4s) BENCH_VEC_FROM(Vec4s, Vec4f) BENCH_VEC_FROM(Vec4s, Vec4i)
+
+BENCH_SINGLE(Vec3f_PointOnCylinder, { o_Vec3f[k] = Vec3f_PointOnCylinder(a_f[k], b_f[k] * 60.0f, a_f[k] * 30.0f); })
+BENCH_SINGLE(Vec3f_PointOnSphere, { o_Vec3f[k] = Vec3f_PointOnSphere(a_f[k], b_f[k] * 60.0f, a_f[k] * 30.0f); })
+
+/* ---- quaternions ------------------------------------------------------ */
+
+BENCH_SINGLE(QuatF_AddWAssignment, { QuatF q = a_Vec4f[k]; QuatF_AddWAssignment(&q, 0.5f); o_Vec4f[k] = q; })
+BENCH_SINGLE(QuatF_SubWAssignment, { QuatF q = a_Vec4f[k]; QuatF_SubWAssignment(&q, 0.5f); o_Vec4f[k] = q; })
+BENCH_SINGLE(QuatF_AddW, { o_Vec4f[k] = QuatF_AddW(a_Vec4f[k], 0.5f); })
+BENCH_SINGLE(QuatF_SubW, { o_Vec4f[k] = QuatF_SubW(a_Vec4f[k], 0.5f); })
+BENCH_SINGLE(QuatF_ConjugateAssignment, { QuatF q = a_Vec4f[k]; QuatF_ConjugateAssignment(&q); o_Vec4f[k] = q; })
+BENCH_SINGLE(QuatF_Conjugate, { o_Vec4f[k] = QuatF_Conjugate(a_Vec4f[k]); })
+BENCH_SINGLE(QuatF_AxisAngleAssignment, { QuatF q; QuatF_AxisAngleAssignment(&q, &a_Vec3f[k], a_f[k]); o_Vec4f[k] = q; })
+BENCH_SINGLE(QuatF_AxisAngle, { o_Vec4f[k] = QuatF_AxisAngle(a_Vec4f[k], &a_Vec3f[k], a_f[k]); })
+BENCH_SINGLE(QuatF_FromEulerAssignment, { QuatF q; QuatF_FromEulerAssignment(&q, &a_Vec3f[k]); o_Vec4f[k] = q; })
+BENCH_SINGLE(QuatF_FromEuler, { o_Vec4f[k] = QuatF_FromEuler(a_Vec3f[k]); })
+BENCH_SINGLE(QuatF_ToAngleAxisAssignment, { Vec3f axis; float angle; QuatF q = Vec4f_Normalize(a_Vec4f[k]); QuatF_ToAngleAxisAssignment(&q, &axis, &angle); o_Vec3f[k] = axis; })
+BENCH_SINGLE(QuatF_ToAngleAxis, { float angle; QuatF q = Vec4f_Normalize(a_Vec4f[k]); o_Vec3f[k] = QuatF_ToAngleAxis(&q, a_Vec3f[k], &angle); })
+BENCH_SINGLE(QuatF_FromLookRotationAssignment, { QuatF q; QuatF_FromLookRotationAssignment(&q, &a_Vec3f[k], (Vec3f*)&Vec3f_Up); o_Vec4f[k] = q; })
+BENCH_SINGLE(QuatF_FromLookRotation, { o_Vec4f[k] = QuatF_FromLookRotation(&a_Vec3f[k], (Vec3f*)&Vec3f_Up); })
+BENCH_SINGLE(QuatF_ToMatrixAssignment, { QuatF_ToMatrixAssignment(mo[k & (MPOOL - 1)], a_Vec4f[k]); })
+BENCH_SINGLE(QuatF_MultiplyAssignment, { QuatF q = a_Vec4f[k]; QuatF_MultiplyAssignment(&q, &b_Vec4f[k]); o_Vec4f[k] = q; })
+BENCH_SINGLE(QuatF_Multiply, { o_Vec4f[k] = QuatF_Multiply(a_Vec4f[k], b_Vec4f[k]); })
+BENCH_SINGLE(QuatF_RotateVec3fAssignment, { Vec3f v = a_Vec3f[k]; QuatF_RotateVec3fAssignment(&v, &a_Vec4f[k]); o_Vec3f[k] = v; })
+BENCH_SINGLE(QuatF_RotateVec3f, { o_Vec3f[k] = QuatF_RotateVec3f(&a_Vec4f[k], a_Vec3f[k]); })
+BENCH_SINGLE(QuatF_NlerpAssignment, { QuatF q = a_Vec4f[k]; QuatF_NlerpAssignment(&q, &b_Vec4f[k], 0.25f); o_Vec4f[k] = q; })
+BENCH_SINGLE(QuatF_Nlerp, { o_Vec4f[k] = QuatF_Nlerp(a_Vec4f[k], b_Vec4f[k], 0.25f); })
+BENCH_SINGLE(QuatF_SlerpAssignment, { QuatF q = quat_a[k]; QuatF_SlerpAssignment(&q, &quat_b[k], 0.25f); o_Vec4f[k] = q; })
+BENCH_SINGLE(QuatF_Slerp, { o_Vec4f[k] = QuatF_Slerp(quat_a[k], quat_b[k], 0.25f); })
+
+/* ---- stream.c --------------------------------------------------------- */
+
+static Vec3fStream s3[3];
+static Vec4fStream s4[3];
+
+static void Bench_SetupStreams(void) {
+    uint32_t n;
+
+    for (n = 0; n < 3; n++) {
+        Vec3fStream_Init(&s3[n], stream_buf[n], BATCH);
+        Vec4fStream_Init(&s4[n], stream_buf[n], BATCH);
+    }
+
+    for (n = 0; n < VEC4F_STREAM_FLOATS(BATCH); n++) {
+        stream_buf[0][n] = Bench_Random(0.5f, 2.0f);
+        stream_buf[1][n] = Bench_Random(0.5f, 2.0f);
+    }
+}
+
+static Vec3f aos3[BATCH];
+static Vec4f aos4[BATCH];
+
+BENCH_SINGLE(Vec3fStream_Init, { Vec3fStream t; Vec3fStream_Init(&t, stream_buf[2], BATCH - k); sink_i = (int32_t)(t.z - t.x); })
+BENCH_SINGLE(Vec4fStream_Init, { Vec4fStream t; Vec4fStream_Init(&t, stream_buf[2], BATCH - k); sink_i = (int32_t)(t.w - t.x); })
+BENCH_BATCH(Vec3fStream_FromVec3f, BATCH, { Vec3fStream_FromVec3f(&s3[2], aos3); })
+BENCH_BATCH(Vec3fStream_ToVec3f, BATCH, { Vec3fStream_ToVec3f(&s3[0], aos3); })
+BENCH_BATCH(Vec3fStream_Add, BATCH, { Vec3fStream_Add(&s3[2], &s3[0], &s3[1]); })
+BENCH_BATCH(Vec3fStream_Sub, BATCH, { Vec3fStream_Sub(&s3[2], &s3[0], &s3[1]); })
+BENCH_BATCH(Vec3fStream_Multiply, BATCH, { Vec3fStream_Multiply(&s3[2], &s3[0], &s3[1]); })
+BENCH_BATCH(Vec3fStream_MultiplyF, BATCH, { Vec3fStream_MultiplyF(&s3[2], &s3[0], 3.0f); })
+BENCH_BATCH(Vec3fStream_Dot, BATCH, { Vec3fStream_Dot(batch_out, &s3[0], &s3[1]); })
+BENCH_BATCH(Vec3fStream_Cross, BATCH, { Vec3fStream_Cross(&s3[2], &s3[0], &s3[1]); })
+BENCH_BATCH(Vec3fStream_Normalize, BATCH, { Vec3fStream_Normalize(&s3[2], &s3[0]); })
+BENCH_BATCH(Vec3fStream_Lerp, BATCH, { Vec3fStream_Lerp(&s3[2], &s3[0], &s3[1], 0.25f); })
+BENCH_BATCH(Vec4fStream_FromVec4f, BATCH, { Vec4fStream_FromVec4f(&s4[2], aos4); })
+BENCH_BATCH(Vec4fStream_ToVec4f, BATCH, { Vec4fStream_ToVec4f(&s4[0], aos4); })
+BENCH_BATCH(Vec4fStream_Add, BATCH, { Vec4fStream_Add(&s4[2], &s4[0], &s4[1]); })
+BENCH_BATCH(Vec4fStream_Sub, BATCH, { Vec4fStream_Sub(&s4[2], &s4[0], &s4[1]); })
+BENCH_BATCH(Vec4fStream_Multiply, BATCH, { Vec4fStream_Multiply(&s4[2], &s4[0], &s4[1]); })
+BENCH_BATCH(Vec4fStream_MultiplyF, BATCH, { Vec4fStream_MultiplyF(&s4[2], &s4[0], 3.0f); })
+BENCH_BATCH(Vec4fStream_Dot, BATCH, { Vec4fStream_Dot(batch_out, &s4[0], &s4[1]); })
+BENCH_BATCH(Vec4fStream_Normalize, BATCH, { Vec4fStream_Normalize(&s4[2], &s4[0]); })
+BENCH_BATCH(Vec4fStream_Lerp, BATCH, { Vec4fStream_Lerp(&s4[2], &s4[0], &s4[1], 0.25f); })
+
+/* ---- quaternion.c ----------------------------------------------------- */
+
+BENCH_BATCH(LibAxis_QuatF_MultiplyArray, BATCH, { LibAxis_QuatF_MultiplyArray(quat_o, quat_a, quat_b, BATCH); })
+BENCH_BATCH(LibAxis_QuatF_NormalizeArray, BATCH, { LibAxis_QuatF_NormalizeArray(quat_o, quat_a, BATCH); })
+BENCH_BATCH(LibAxis_QuatF_RotateVec3fArray, BATCH, { LibAxis_QuatF_RotateVec3fArray(aos3, quat_a, aos3, BATCH); })
+BENCH_BATCH(LibAxis_QuatF_NlerpArray, BATCH, { LibAxis_QuatF_NlerpArray(quat_o, quat_a, quat_b, 0.25f, BATCH); })
+BENCH_BATCH(LibAxis_QuatF_SlerpArray, BATCH, { LibAxis_QuatF_SlerpArray(quat_o, quat_a, quat_b, 0.25f, BATCH); })
+
+/* ---- pose.c ----------------------------------------------------------- */
+
+static Pose* pose_list[2] = {&pose_a, &pose_b};
+static float pose_weights[2] = {0.75f, 0.25f};
+
+BENCH_SINGLE(LibAxis_Pose_Init, { Pose t; LibAxis_Pose_Init(&t, pose_buf[2], MPOOL - (k & 31)); sink_i = (int32_t)t.count; })
+BENCH_BATCH(LibAxis_Pose_Identity, MPOOL, { LibAxis_Pose_Identity(&pose_o); })
+BENCH_BATCH(LibAxis_Pose_Blend, MPOOL, { LibAxis_Pose_Blend(&pose_o, &pose_a, &pose_b, 0.25f); })
+BENCH_BATCH(LibAxis_Pose_BlendWeighted, MPOOL, { LibAxis_Pose_BlendWeighted(&pose_o, pose_list, pose_weights, 2); })
+BENCH_BATCH(LibAxis_Pose_LocalMatrices, MPOOL, { LibAxis_Pose_LocalMatrices(mo, &pose_a); })
+BENCH_BATCH(LibAxis_Pose_ModelMatrices, MPOOL, { LibAxis_Pose_ModelMatrices(mo, &pose_a, pose_parents); })
+BENCH_BATCH(LibAxis_Pose_SkinningMatrices, MPOOL, { LibAxis_Pose_SkinningMatrices(mo, mr, ma, MPOOL); })
+BENCH_BATCH(LibAxis_Pose_SkinningMatricesFixed, MPOOL, { LibAxis_Pose_SkinningMatricesFixed(mfx, mr, ma, MPOOL); })
+
+/* ---- transform.c ------------------------------------------------------ */
+
+/* A root with BATCH / 16 limbs of 15 leaves each, in pre-order. */
+static void Bench_BuildTree(void) {
+    uint32_t n;
+
+    LibAxis_Transform_Init(&tree, tree_buf, BATCH);
+    for (n = 0; n < BATCH; n++)
+        LibAxis_Transform_Add(&tree, (n == 0) ? LA_TRANSFORM_NONE : (int32_t)((n & 15) ? (n & ~15u) : 0), mr[n & (MPOOL - 1)]);
+    LibAxis_Transform_Update(&tree);
+}
+
+BENCH_SINGLE(LibAxis_Transform_Init, { TransformTree t; LibAxis_Transform_Init(&t, tree_buf, BATCH - k); sink_i = (int32_t)t.capacity; })
+BENCH_BATCH(LibAxis_Transform_Add, BATCH, { Bench_BuildTree(); })
+BENCH_SINGLE(LibAxis_Transform_SetLocal, { LibAxis_Transform_SetLocal(&tree, (int32_t)k, mr[k & (MPOOL - 1)]); })
+BENCH_SINGLE(LibAxis_Transform_MarkDirty, { LibAxis_Transform_MarkDirty(&tree, (int32_t)k); })
+BENCH_BATCH(LibAxis_Transform_Update, BATCH, { LibAxis_Transform_MarkDirty(&tree, 0); sink_i = (int32_t)LibAxis_Transform_Update(&tree); })
+BENCH_SINGLE_NAMED(LibAxis_Transform_Update_Leaf, "LibAxis_Transform_Update (one leaf)", { LibAxis_Transform_MarkDirty(&tree, (int32_t)(k | 1)); sink_i = (int32_t)LibAxis_Transform_Update(&tree); })
+BENCH_SINGLE_NAMED(LibAxis_Transform_Update_Clean, "LibAxis_Transform_Update (clean)", { sink_i = (int32_t)LibAxis_Transform_Update(&tree); })
+
+/* ---- frustum.c -------------------------------------------------------- */
+
+static Vec3fStream cull_center, cull_min, cull_max;
+static Frustum cull_frustum;
+
+/* A 90 degree perspective looking down -z, over objects scattered in a 200 unit cube around it. */
+static void Bench_SetupCull(void) {
+    float proj[4][4] = {{1.0f, 0.0f, 0.0f, 0.0f}, {0.0f, 1.0f, 0.0f, 0.0f}, {0.0f, 0.0f, -1.002f, -1.0f}, {0.0f, 0.0f, -0.2002f, 0.0f}};
+    float r;
+    uint32_t n;
+
+    LibAxis_Frustum_FromMatrix44F(&cull_frustum, proj);
+    Vec3fStream_Init(&cull_center, cull_buf[0], BATCH);
+    Vec3fStream_Init(&cull_min, cull_buf[1], BATCH);
+    Vec3fStream_Init(&cull_max, cull_buf[2], BATCH);
+
+    for (n = 0; n < BATCH; n++) {
+        cull_center.x[n] = Bench_Random(-100.0f, 100.0f);
+        cull_center.y[n] = Bench_Random(-100.0f, 100.0f);
+        cull_center.z[n] = Bench_Random(-100.0f, 100.0f);
+        cull_radius[n] = r = Bench_Random(0.5f, 4.0f);
+        cull_min.x[n] = cull_center.x[n] - r;
+        cull_min.y[n] = cull_center.y[n] - r;
+        cull_min.z[n] = cull_center.z[n] - r;
+        cull_max.x[n] = cull_center.x[n] + r;
+        cull_max.y[n] = cull_center.y[n] + r;
+        cull_max.z[n] = cull_center.z[n] + r;
+    }
+}
+
+BENCH_SINGLE(LibAxis_Frustum_FromMatrix44F, { Frustum t; LibAxis_Frustum_FromMatrix44F(&t, ma[k & (MPOOL - 1)]); sink_f = t.plane[LA_FRUSTUM_FAR].w; })
+BENCH_SINGLE(LibAxis_Frustum_TestSphere, { Vec3f c = VEC3F_NEW(cull_center.x[k], cull_center.y[k], cull_center.z[k]); sink_i += LibAxis_Frustum_TestSphere(&cull_frustum, &c, cull_radius[k]); })
+BENCH_SINGLE(LibAxis_Frustum_TestAABB, { Vec3f lo = VEC3F_NEW(cull_min.x[k], cull_min.y[k], cull_min.z[k]), hi = VEC3F_NEW(cull_max.x[k], cull_max.y[k], cull_max.z[k]); sink_i += LibAxis_Frustum_TestAABB(&cull_frustum, &lo, &hi); })
+BENCH_BATCH(LibAxis_Frustum_CullSpheres, BATCH, { sink_i = (int32_t)LibAxis_Frustum_CullSpheres(&cull_frustum, cull_visible, &cull_center, cull_radius); })
+BENCH_BATCH(LibAxis_Frustum_CullAABBs, BATCH, { sink_i = (int32_t)LibAxis_Frustum_CullAABBs(&cull_frustum, cull_visible, &cull_min, &cull_max); })
+
+/* ---- bvh.c ------------------------------------------------------------ */
+
+static Bvh bvh, bvh_box;
+
+/* Small triangles around the culling centers, the culling boxes, and probes scattered through the same cube. */
+static void Bench_SetupBvh(void) {
+    uint32_t n;
+
+    for (n = 0; n < BATCH * 3; n++)
+        bvh_tri[n] = VEC3F_NEW(cull_center.x[n / 3] + Bench_Random(-2.0f, 2.0f), cull_center.y[n / 3] + Bench_Random(-2.0f, 2.0f), cull_center.z[n / 3] + Bench_Random(-2.0f, 2.0f));
+    for (n = 0; n < BATCH; n++) {
+        bvh_min[n] = VEC3F_NEW(cull_min.x[n], cull_min.y[n], cull_min.z[n]);
+        bvh_max[n] = VEC3F_NEW(cull_max.x[n], cull_max.y[n], cull_max.z[n]);
+    }
+    for (n = 0; n < POOL; n++) {
+        bvh_point[n] = VEC3F_NEW(Bench_Random(-100.0f, 100.0f), Bench_Random(-100.0f, 100.0f), Bench_Random(-100.0f, 100.0f));
+        bvh_dir[n] = VEC3F_NEW(Bench_Random(-1.0f, 1.0f), Bench_Random(-1.0f, 1.0f), Bench_Random(-1.0f, 1.0f));
+    }
+
+    LibAxis_Bvh_Init(&bvh, bvh_buf[0], BATCH);
+    LibAxis_Bvh_BuildTriangles(&bvh, bvh_tri, BATCH);
+    LibAxis_Bvh_Init(&bvh_box, bvh_buf[1], BATCH);
+    LibAxis_Bvh_BuildAABBs(&bvh_box, bvh_min, bvh_max, BATCH);
+}
+
+BENCH_SINGLE(LibAxis_Bvh_Init, { Bvh t; LibAxis_Bvh_Init(&t, bvh_buf[2], BATCH - k); sink_i = (int32_t)t.capacity; })
+BENCH_BATCH(LibAxis_Bvh_BuildAABBs, BATCH, { sink_i = (int32_t)LibAxis_Bvh_BuildAABBs(&bvh_box, bvh_min, bvh_max, BATCH); })
+BENCH_BATCH(LibAxis_Bvh_BuildTriangles, BATCH, { sink_i = (int32_t)LibAxis_Bvh_BuildTriangles(&bvh, bvh_tri, BATCH); })
+BENCH_BATCH(LibAxis_Bvh_RefitAABBs, BATCH, { LibAxis_Bvh_RefitAABBs(&bvh_box, bvh_min, bvh_max); })
+BENCH_BATCH(LibAxis_Bvh_RefitTriangles, BATCH, { LibAxis_Bvh_RefitTriangles(&bvh, bvh_tri); })
+BENCH_SINGLE(LibAxis_Bvh_Raycast, { float t = 400.0f; sink_i = LibAxis_Bvh_Raycast(&bvh, &bvh_point[k], &bvh_dir[k], &t); })
+BENCH_SINGLE_NAMED(LibAxis_Bvh_Raycast_Box, "LibAxis_Bvh_Raycast (boxes)", { float t = 400.0f; sink_i = LibAxis_Bvh_Raycast(&bvh_box, &bvh_point[k], &bvh_dir[k], &t); })
+BENCH_SINGLE(LibAxis_Bvh_QueryAABB, {
+    Vec3f lo = VEC3F_NEW(bvh_point[k].x - 8.0f, bvh_point[k].y - 8.0f, bvh_point[k].z - 8.0f), hi = VEC3F_NEW(bvh_point[k].x + 8.0f, bvh_point[k].y + 8.0f, bvh_point[k].z + 8.0f);
+    sink_i = (int32_t)LibAxis_Bvh_QueryAABB(&bvh_box, &lo, &hi, cull_visible, BATCH); })
+BENCH_SINGLE(LibAxis_Bvh_Nearest, { Vec3f c; float d = 3.4e38f; sink_i = LibAxis_Bvh_Nearest(&bvh, &bvh_point[k], &c, &d); })
+BENCH_SINGLE_NAMED(LibAxis_Bvh_Nearest_Box, "LibAxis_Bvh_Nearest (boxes)", { Vec3f c; float d = 3.4e38f; sink_i = LibAxis_Bvh_Nearest(&bvh_box, &bvh_point[k], &c, &d); })
+BENCH_SINGLE_NAMED(LibAxis_Bvh_Nearest_Linear, "LibAxis_Bvh_Nearest (linear vertex scan)", {
+    Vec3f d; float dist, best = 3.4e38f; uint32_t n;
+    for (n = 0; n < BATCH * 3; n++) { d = Vec3f_Sub(bvh_tri[n], bvh_point[k]); dist = Vec3f_Dot(&d, &d); best = (dist < best) ? dist : best; }
+    sink_f = best; })
+
+/* ---- hashgrid.c ------------------------------------------------------- */
+
+static HashGrid grid;
+
+/* A crowd of BATCH agents in a 40 unit cube, with 2 unit cells and 2 unit query radii. */
+static void Bench_SetupGrid(void) {
+    uint32_t n;
+
+    for (n = 0; n < BATCH; n++)
+        grid_points[n] = VEC3F_NEW(Bench_Random(-20.0f, 20.0f), Bench_Random(-20.0f, 20.0f), Bench_Random(-20.0f, 20.0f));
+
+    LibAxis_HashGrid_Init(&grid, grid_buf[0], BATCH, 2.0f);
+    LibAxis_HashGrid_Build(&grid, grid_points, BATCH);
+}
+
+BENCH_SINGLE(LibAxis_HashGrid_Init, { HashGrid t; LibAxis_HashGrid_Init(&t, grid_buf[1], BATCH - k, 2.0f); sink_i = (int32_t)t.mask; })
+BENCH_BATCH(LibAxis_HashGrid_Build, BATCH, { sink_i = (int32_t)LibAxis_HashGrid_Build(&grid, grid_points, BATCH); })
+BENCH_SINGLE(LibAxis_HashGrid_QueryRadius, { sink_i = (int32_t)LibAxis_HashGrid_QueryRadius(&grid, &grid_points[k], 2.0f, cull_visible, BATCH); })
+BENCH_BATCH(LibAxis_HashGrid_Pairs, BATCH, { sink_i = (int32_t)LibAxis_HashGrid_Pairs(&grid, 2.0f, grid_pairs, BATCH * 16); })
+BENCH_BATCH_NAMED(LibAxis_HashGrid_Pairs_Brute, "LibAxis_HashGrid_Pairs (Vec3f_Distance n^2)", BATCH, {
+    uint32_t a, b, n = 0;
+    for (a = 0; a < BATCH; a++) { for (b = a + 1; b < BATCH; b++) n += (Vec3f_Distance(grid_points[a], grid_points[b]) <= 2.0f); }
+    sink_i = (int32_t)n; })
+
+/* ---- fixed.c ---------------------------------------------------------- */
+
+static qs1616_t fixed_a[POOL], fixed_b[POOL];
+static qs1616_t mqa[MPOOL][4][4], mqb[MPOOL][4][4], mqo[MPOOL][4][4];
+static Vec3i fixed_va[POOL], fixed_vb[POOL], fixed_points[BATCH], fixed_out[BATCH];
+static Vec3s fixed_sa[POOL], fixed_sb[POOL];
+
+/* The float pools as Q16.16, and Q1.15 vectors in [-0.5, 0.5). */
+static void Bench_SetupFixed(void) {
+    uint32_t n;
+
+    for (n = 0; n < POOL; n++) {
+        fixed_a[n] = qs1616(a_f[n]);
+        fixed_b[n] = qs1616(b_f[n]);
+        fixed_va[n] = VEC3I_NEW(qs1616(a_Vec3f[n].x), qs1616(a_Vec3f[n].y), qs1616(a_Vec3f[n].z));
+        fixed_vb[n] = VEC3I_NEW(qs1616(b_Vec3f[n].x), qs1616(b_Vec3f[n].y), qs1616(b_Vec3f[n].z));
+        fixed_sa[n] = VEC3S_NEW(qs115(Bench_Random(-0.5f, 0.5f)), qs115(Bench_Random(-0.5f, 0.5f)), qs115(Bench_Random(-0.5f, 0.5f)));
+        fixed_sb[n] = VEC3S_NEW(qs115(Bench_Random(-0.5f, 0.5f)), qs115(Bench_Random(-0.5f, 0.5f)), qs115(Bench_Random(-0.5f, 0.5f)));
+    }
+
+    for (n = 0; n < MPOOL; n++) {
+        LibAxis_Fixed_Matrix44FromMatrix44F(mqa[n], ma[n]);
+        LibAxis_Fixed_Matrix44FromMatrix44F(mqb[n], mb[n]);
+    }
+
+    for (n = 0; n < BATCH; n++)
+        fixed_points[n] = fixed_va[n & MASK];
+}
+
+BENCH_SINGLE(LibAxis_Fixed_AddSat, { sink_i = LibAxis_Fixed_AddSat(fixed_a[k], fixed_b[k]); })
+BENCH_SINGLE(LibAxis_Fixed_SubSat, { sink_i = LibAxis_Fixed_SubSat(fixed_a[k], fixed_b[k]); })
+BENCH_SINGLE(LibAxis_Fixed_MulSat, { sink_i = LibAxis_Fixed_MulSat(fixed_a[k], fixed_b[k]); })
+BENCH_SINGLE(LibAxis_Fixed_Sqrt, { sink_i = LibAxis_Fixed_Sqrt(fixed_a[k]); })
+BENCH_SINGLE(LibAxis_Fixed_RSqrt, { sink_i = LibAxis_Fixed_RSqrt(fixed_a[k]); })
+BENCH_SINGLE(LibAxis_Fixed_Vec3iAddSat, { LibAxis_Fixed_Vec3iAddSat(&o_Vec3i[k], &fixed_va[k], &fixed_vb[k]); })
+BENCH_SINGLE(LibAxis_Fixed_Vec3iSubSat, { LibAxis_Fixed_Vec3iSubSat(&o_Vec3i[k], &fixed_va[k], &fixed_vb[k]); })
+BENCH_SINGLE(LibAxis_Fixed_Vec3iScaleSat, { LibAxis_Fixed_Vec3iScaleSat(&o_Vec3i[k], &fixed_va[k], fixed_b[k]); })
+BENCH_SINGLE(LibAxis_Fixed_Vec3iDot, { sink_i = LibAxis_Fixed_Vec3iDot(&fixed_va[k], &fixed_vb[k]); })
+BENCH_SINGLE(LibAxis_Fixed_Vec3iCross, { LibAxis_Fixed_Vec3iCross(&o_Vec3i[k], &fixed_va[k], &fixed_vb[k]); })
+BENCH_SINGLE(LibAxis_Fixed_Vec3iNormalize, { LibAxis_Fixed_Vec3iNormalize(&o_Vec3i[k], &fixed_va[k]); })
+BENCH_SINGLE(LibAxis_Fixed_Vec3sAddSat, { LibAxis_Fixed_Vec3sAddSat(&o_Vec3s[k], &fixed_sa[k], &fixed_sb[k]); })
+BENCH_SINGLE(LibAxis_Fixed_Vec3sSubSat, { LibAxis_Fixed_Vec3sSubSat(&o_Vec3s[k], &fixed_sa[k], &fixed_sb[k]); })
+BENCH_SINGLE(LibAxis_Fixed_Vec3sMulSat, { LibAxis_Fixed_Vec3sMulSat(&o_Vec3s[k], &fixed_sa[k], &fixed_sb[k]); })
+BENCH_SINGLE(LibAxis_Fixed_Vec3sScaleSat, { LibAxis_Fixed_Vec3sScaleSat(&o_Vec3s[k], &fixed_sa[k], fixed_sb[k].x); })
+BENCH_SINGLE(LibAxis_Fixed_Vec3sDot, { sink_i = LibAxis_Fixed_Vec3sDot(&fixed_sa[k], &fixed_sb[k]); })
+BENCH_SINGLE(LibAxis_Fixed_Vec3sCross, { LibAxis_Fixed_Vec3sCross(&o_Vec3s[k], &fixed_sa[k], &fixed_sb[k]); })
+BENCH_SINGLE(LibAxis_Fixed_Vec3sNormalize, { LibAxis_Fixed_Vec3sNormalize(&o_Vec3s[k], &fixed_sa[k]); })
+BENCH_SINGLE(LibAxis_Fixed_Matrix44FromMatrix44F, { LibAxis_Fixed_Matrix44FromMatrix44F(mqo[k & (MPOOL - 1)], ma[k & (MPOOL - 1)]); })
+BENCH_SINGLE(LibAxis_Fixed_Matrix44ToMatrix44F, { LibAxis_Fixed_Matrix44ToMatrix44F(mo[k & (MPOOL - 1)], mqa[k & (MPOOL - 1)]); })
+BENCH_SINGLE(LibAxis_Fixed_Matrix44Multiply, { LibAxis_Fixed_Matrix44Multiply(mqa[k & (MPOOL - 1)], mqb[k & (MPOOL - 1)], mqo[k & (MPOOL - 1)]); })
+BENCH_SINGLE(LibAxis_Fixed_Matrix44TransformPoint, { LibAxis_Fixed_Matrix44TransformPoint(&o_Vec3i[k], &fixed_va[k], mqa[k & (MPOOL - 1)]); })
+BENCH_BATCH(LibAxis_Fixed_Matrix44TransformPointArray, BATCH, { LibAxis_Fixed_Matrix44TransformPointArray(fixed_out, fixed_points, mqa[0], BATCH); })
+BENCH_SINGLE(LibAxis_Fixed_PackMatrix44, { LibAxis_Fixed_PackMatrix44(&mfx[k & (MPOOL - 1)], mqa[k & (MPOOL - 1)]); })
+BENCH_SINGLE(LibAxis_Fixed_UnpackMatrix44, { LibAxis_Fixed_UnpackMatrix44(mqo[k & (MPOOL - 1)], &mfx[k & (MPOOL - 1)]); })
+
+/* ---- ray.c ------------------------------------------------------------ */
+
+static Vec3fStream ray_os, ray_ds;
+static RayHitStream ray_hits;
+static Vec3f ray_tri[3] = {{-40.0f, -40.0f, 0.0f}, {40.0f, -30.0f, 5.0f}, {-10.0f, 45.0f, -5.0f}};
+static Vec3f ray_min = {-20.0f, -20.0f, -20.0f}, ray_max = {20.0f, 20.0f, 20.0f}, ray_center = {0.0f, 0.0f, 0.0f};
+
+/* A lightmap-style batch: rays from a plane at z = -100 fanning out along +z, about half of them hitting each primitive. */
+static void Bench_SetupRays(void) {
+    uint32_t n;
+
+    for (n = 0; n < BATCH; n++) {
+        ray_origin[n] = VEC3F_NEW(Bench_Random(-50.0f, 50.0f), Bench_Random(-50.0f, 50.0f), -100.0f);
+        ray_dir[n] = VEC3F_NEW(Bench_Random(-0.2f, 0.2f), Bench_Random(-0.2f, 0.2f), 1.0f);
+    }
+
+    Vec3fStream_Init(&ray_os, ray_buf[0], BATCH);
+    Vec3fStream_Init(&ray_ds, ray_buf[1], BATCH);
+    Vec3fStream_FromVec3f(&ray_os, ray_origin);
+    Vec3fStream_FromVec3f(&ray_ds, ray_dir);
+    LibAxis_Ray_InitHits(&ray_hits, ray_hit_buf, BATCH, 400.0f);
+}
+
+BENCH_BATCH(LibAxis_Ray_InitHits, BATCH, { LibAxis_Ray_InitHits(&ray_hits, ray_hit_buf, BATCH, 400.0f); })
+BENCH_SINGLE(LibAxis_Ray_Triangle, { RayHit h = {400.0f, 0.0f, 0.0f}; sink_i = LibAxis_Ray_Triangle(&h, &ray_origin[k], &ray_dir[k], ray_tri); })
+BENCH_SINGLE(LibAxis_Ray_AABB, { RayHit h = {400.0f, 0.0f, 0.0f}; sink_i = LibAxis_Ray_AABB(&h, &ray_origin[k], &ray_dir[k], &ray_min, &ray_max); })
+BENCH_SINGLE(LibAxis_Ray_Sphere, { RayHit h = {400.0f, 0.0f, 0.0f}; sink_i = LibAxis_Ray_Sphere(&h, &ray_origin[k], &ray_dir[k], &ray_center, 30.0f); })
+BENCH_BATCH(LibAxis_Ray_TrianglePacket, BATCH, { LibAxis_Ray_TrianglePacket(&ray_hits, &ray_os, &ray_ds, ray_tri, 0); })
+BENCH_BATCH(LibAxis_Ray_AABBPacket, BATCH, { LibAxis_Ray_AABBPacket(&ray_hits, &ray_os, &ray_ds, &ray_min, &ray_max, 1); })
+BENCH_BATCH(LibAxis_Ray_SpherePacket, BATCH, { LibAxis_Ray_SpherePacket(&ray_hits, &ray_os, &ray_ds, &ray_center, 30.0f, 2); })
+BENCH_BATCH_NAMED(LibAxis_Ray_TrianglePacket_Single, "LibAxis_Ray_TrianglePacket (LibAxis_Ray_Triangle loop)", BATCH, {
+    RayHit h; uint32_t n;
+    for (n = 0; n < BATCH; n++) { h.t = 400.0f; sink_i = LibAxis_Ray_Triangle(&h, &ray_origin[n], &ray_dir[n], ray_tri); } })
+
+/* ---- camera.c --------------------------------------------------------- */
+
+static Camera camera;
+
+BENCH_SINGLE(LibAxis_Camera_Init, { LibAxis_Camera_Init(&camera); })
+BENCH_SINGLE(LibAxis_Camera_LookAt, { LibAxis_Camera_LookAt(&camera, &a_Vec3f[k], &b_Vec3f[k], &a_Vec3f[(k + 1) & (POOL - 1)]); })
+BENCH_SINGLE(LibAxis_Camera_Perspective, { LibAxis_Camera_Perspective(&camera, 60.0f + a_f[k], 1.5f, 0.1f, 1000.0f); })
+BENCH_SINGLE(LibAxis_Camera_Orthographic, { LibAxis_Camera_Orthographic(&camera, -a_f[k], a_f[k], -b_f[k], b_f[k], 0.1f, 1000.0f); })
+BENCH_SINGLE(LibAxis_Camera_Update, { LibAxis_Camera_LookAt(&camera, &a_Vec3f[k], &b_Vec3f[k], &a_Vec3f[(k + 1) & (POOL - 1)]); sink_i = (int32_t)LibAxis_Camera_Update(&camera); })
+BENCH_SINGLE_NAMED(LibAxis_Camera_Update_Clean, "LibAxis_Camera_Update (unchanged)", { LibAxis_Camera_LookAt(&camera, &a_Vec3f[0], &b_Vec3f[0], &a_Vec3f[1]); sink_i = (int32_t)LibAxis_Camera_Update(&camera); })
+BENCH_SINGLE(LibAxis_Camera_UpdateInverse, { LibAxis_Camera_LookAt(&camera, &a_Vec3f[k], &b_Vec3f[k], &a_Vec3f[(k + 1) & (POOL - 1)]); sink_i = LibAxis_Camera_UpdateInverse(&camera); })
+BENCH_SINGLE(LibAxis_Camera_Unproject, { sink_i = LibAxis_Camera_Unproject(&camera, &o_Vec3f[k], &a_Vec3f[k]); })
+BENCH_SINGLE(LibAxis_Camera_PickRay, { sink_i = LibAxis_Camera_PickRay(&camera, &o_Vec3f[k], &o_Vec3f[(k + 1) & (POOL - 1)], a_f[k], b_f[k]); })
+
+/* ---- matrixstack.c ---------------------------------------------------- */
+
+/* A camera level and a model level, as a display list would leave them between draws. */
+static void Bench_SetupMatrixStack(void) {
+    LibAxis_MatrixStack_Init(&mstack, mstack_buf, 16);
+    LibAxis_MatrixStack_Load(&mstack, mr[0]);
+    LibAxis_MatrixStack_Push(&mstack);
+    LibAxis_MatrixStack_Multiply(&mstack, mr[1]);
+    LibAxis_MatrixStack_TopFixed(&mstack);
+}
+
+BENCH_SINGLE(LibAxis_MatrixStack_Init, { MatrixStack t; LibAxis_MatrixStack_Init(&t, mstack_buf, 16 - (k & 7)); sink_i = (int32_t)t.capacity; })
+BENCH_SINGLE_NAMED(LibAxis_MatrixStack_Push_Pop, "LibAxis_MatrixStack_Push + Pop", { LibAxis_MatrixStack_Push(&mstack); sink_i = LibAxis_MatrixStack_Pop(&mstack); })
+BENCH_SINGLE(LibAxis_MatrixStack_Load, { LibAxis_MatrixStack_Push(&mstack); LibAxis_MatrixStack_Load(&mstack, mr[k & (MPOOL - 1)]); LibAxis_MatrixStack_Pop(&mstack); })
+BENCH_SINGLE(LibAxis_MatrixStack_Multiply, { LibAxis_MatrixStack_Push(&mstack); LibAxis_MatrixStack_Multiply(&mstack, mr[k & (MPOOL - 1)]); LibAxis_MatrixStack_Multiply(&mstack, mr[(k + 1) & (MPOOL - 1)]); LibAxis_MatrixStack_Pop(&mstack); })
+BENCH_SINGLE(LibAxis_MatrixStack_Top, { LibAxis_MatrixStack_Push(&mstack); LibAxis_MatrixStack_Multiply(&mstack, mr[k & (MPOOL - 1)]); sink_f = LibAxis_MatrixStack_Top(&mstack)[3][0]; LibAxis_MatrixStack_Pop(&mstack); })
+BENCH_SINGLE_NAMED(LibAxis_MatrixStack_Top_Clean, "LibAxis_MatrixStack_Top (unchanged)", { sink_f = LibAxis_MatrixStack_Top(&mstack)[3][0]; })
+BENCH_SINGLE(LibAxis_MatrixStack_TopFixed, { LibAxis_MatrixStack_Push(&mstack); LibAxis_MatrixStack_Multiply(&mstack, mr[k & (MPOOL - 1)]); sink_i = LibAxis_MatrixStack_TopFixed(&mstack)->l[12]; LibAxis_MatrixStack_Pop(&mstack); })
+BENCH_SINGLE_NAMED(LibAxis_MatrixStack_TopFixed_Clean, "LibAxis_MatrixStack_TopFixed (unchanged)", { sink_i = LibAxis_MatrixStack_TopFixed(&mstack)->l[12]; })
+
+/* ---- arena.c ---------------------------------------------------------- */
+
+BENCH_SINGLE(LibAxis_Arena_Init, { LibAxis_Arena_Init(&arena, arena_buf, sizeof(arena_buf) - k); })
+BENCH_SINGLE(LibAxis_Arena_Alloc, { if (LibAxis_Arena_Alloc(&arena, 48, LA_ARENA_ALIGN) == NULL) LibAxis_Arena_Reset(&arena); })
+BENCH_SINGLE(LibAxis_Arena_AllocShared, { if (LibAxis_Arena_AllocShared(&arena, 48, LA_ARENA_ALIGN) == NULL) LibAxis_Arena_Reset(&arena); })
+BENCH_SINGLE_NAMED(LibAxis_Arena_Mark_Rewind, "LibAxis_Arena_Mark + Rewind", { uint32_t m = LibAxis_Arena_Mark(&arena); LibAxis_Arena_Alloc(&arena, 48, LA_ARENA_ALIGN); LibAxis_Arena_Rewind(&arena, m); })
+BENCH_SINGLE(LibAxis_Arena_AllocVec3fStream, { Vec3fStream t; if (!LibAxis_Arena_AllocVec3fStream(&arena, &t, k & (POOL - 1))) LibAxis_Arena_Reset(&arena); })
+BENCH_SINGLE(LibAxis_Arena_AllocVec4fStream, { Vec4fStream t; if (!LibAxis_Arena_AllocVec4fStream(&arena, &t, k & (POOL - 1))) LibAxis_Arena_Reset(&arena); })
+
+/* ---- jobs.c ----------------------------------------------------------- */
+
+/* Without host threads this times the chunking and inline fallback, against the kernel called once. */
+static void Bench_JobTransform(void* data, uint32_t begin, uint32_t end, uint32_t worker) {
+    LibAxis_Matrix44_TransformPointArrayF(mr[0], &job_out[begin], &ray_origin[begin], end - begin);
+}
+
+static void Bench_JobMark(void* data, uint32_t begin, uint32_t end, uint32_t worker) {
+    JobCheck* check = (JobCheck*)data;
+    uint32_t i;
+
+    if (begin % check->chunk != 0 || end > check->count || worker >= JOB_CHECK_WORKERS)
+        __atomic_fetch_add(&check->bad, 1, __ATOMIC_RELAXED);
+
+    /* Give the other workers a turn mid-job, or on a single core the issuer runs everything. */
+    sched_yield();
+    for (i = begin; i < end; i++)
+        __atomic_fetch_add(&check->hits[i], 1, __ATOMIC_RELAXED);
+}
+
+static void* Bench_JobWorker(void* arg) {
+    LibAxis_Jobs_Worker(&jobs, (uint32_t)(uintptr_t)arg);
+    return NULL;
+}
+
+static void Bench_JobIdle(void) {
+    sched_yield();
+}
+
+/*
+ * The timed cases run on one worker so they mean the same on every host, so
+ * this checks the threaded path before them: jobs on real threads, alternating
+ * between two contexts so a chunk run with a stale job's fields lands in the
+ * wrong one, must hit every index exactly once.
+ */
+static int32_t Bench_CheckJobs(void) {
+    pthread_t threads[JOB_CHECK_WORKERS];
+    uint32_t run, i, w, started, errors = 0;
+    JobCheck* check;
+
+    LibAxis_Jobs_Init(&jobs, job_queues, JOB_CHECK_WORKERS, Bench_JobIdle);
+    for (started = 1; started < JOB_CHECK_WORKERS; started++) {
+        if (pthread_create(&threads[started], NULL, Bench_JobWorker, (void*)(uintptr_t)started) != 0)
+            break;
+    }
+
+    for (run = 0; run < JOB_CHECK_RUNS && started == JOB_CHECK_WORKERS; run++) {
+        check = &job_check[run & 1];
+        check->count = 1 + ((run * 7919) % BATCH);
+        check->chunk = 1 + ((run * 31) % 97);
+        LibAxis_Jobs_ParallelFor(&jobs, Bench_JobMark, check, check->count, check->chunk);
+
+        for (i = 0; i < BATCH; i++)
+            errors += (check->hits[i] != (i < check->count));
+        errors += check->bad;
+        memset(check, 0, sizeof(*check));
+    }
+
+    LibAxis_Jobs_Stop(&jobs);
+    for (w = 1; w < started; w++)
+        pthread_join(threads[w], NULL);
+    LibAxis_Jobs_Init(&jobs, job_queues, 1, NULL);
+
+    if (started != JOB_CHECK_WORKERS) {
+        fprintf(stderr, "bench: could not start %d job workers\n", JOB_CHECK_WORKERS);
+        return 0;
+    }
+    if (errors != 0) {
+        fprintf(stderr, "bench: LibAxis_Jobs_ParallelFor on %d workers missed or repeated %u indices\n", JOB_CHECK_WORKERS, errors);
+        return 0;
+    }
+    return 1;
+}
+
+BENCH_SINGLE(LibAxis_Jobs_Init, { LibAxis_Jobs_Init(&jobs, job_queues, 1, NULL); })
+BENCH_BATCH_NAMED(LibAxis_Jobs_ParallelFor, "LibAxis_Jobs_ParallelFor (chunk 64)", BATCH, { LibAxis_Jobs_ParallelFor(&jobs, Bench_JobTransform, NULL, BATCH, 64); })
+BENCH_BATCH_NAMED(LibAxis_Jobs_ParallelFor_Inline, "LibAxis_Jobs_ParallelFor (one chunk)", BATCH, { LibAxis_Jobs_ParallelFor(&jobs, Bench_JobTransform, NULL, BATCH, BATCH); })
+
+/* ---- dispatch.c ------------------------------------------------------- */
+
+static uint32_t bench_dispatch = LA_CPU_ALL;
+static uint32_t bench_kernels;
+
+BENCH_SINGLE(LibAxis_Cpu_Features, { sink_i = (int32_t)LibAxis_Cpu_Features(); })
+BENCH_SINGLE(LibAxis_Dispatch_Init, { sink_i = (int32_t)LibAxis_Dispatch_Init(bench_dispatch); })
+
+/* ---- lamath.c --------------------------------------------------------- */
+
+BENCH_SINGLE(LibAxis_MinF3, { sink_f = LibAxis_MinF3(a_f[k], b_f[k], a_f[(k + 1) & MASK]); })
+BENCH_SINGLE(LibAxis_MaxF3, { sink_f = LibAxis_MaxF3(a_f[k], b_f[k], a_f[(k + 1) & MASK]); })
+BENCH_SINGLE(LibAxis_ModF, { sink_f = LibAxis_ModF(a_f[k], b_f[k]); })
+BENCH_SINGLE(LibAxis_PowI, { sink_i = LibAxis_PowI(a_i[k], b_i[k]); })
+BENCH_SINGLE(LibAxis_PowF, { sink_f = LibAxis_PowF(a_f[k], b_i[k]); })
+BENCH_SINGLE(LibAxis_Abs, { sink_i = LibAxis_Abs(a_i[k]); })
+BENCH_SINGLE(LibAxis_SinF, { sink_f = LibAxis_SinF(a_f[k]); })
+BENCH_SINGLE(LibAxis_CosF, { sink_f = LibAxis_CosF(a_f[k]); })
+BENCH_SINGLE(LibAxis_SinCosF, { float s, c; LibAxis_SinCosF(a_f[k], &s, &c); sink_f = s + c; })
+BENCH_SINGLE(LibAxis_TrigReduceLargeF, { int32_t q; sink_f = LibAxis_TrigReduceLargeF(a_f[k] * 1.0e6f, &q); sink_i = q; })
+BENCH_SINGLE(LibAxis_ArcCosF, { sink_f = LibAxis_ArcCosF(a_f[k]); })
+BENCH_SINGLE(LibAxis_SqrtF, { sink_f = LibAxis_SqrtF(a_f[k]); })
+BENCH_SINGLE(LibAxis_RSqrtF, { sink_f = LibAxis_RSqrtF(a_f[k]); })
+BENCH_SINGLE_NAMED(LibAxis_SqrtLevelF_Estimate, "LibAxis_SqrtLevelF/estimate", { sink_f = LibAxis_SqrtLevelF(a_f[k], LA_SQRT_ESTIMATE); })
+BENCH_SINGLE_NAMED(LibAxis_SqrtLevelF_Fast, "LibAxis_SqrtLevelF/fast", { sink_f = LibAxis_SqrtLevelF(a_f[k], LA_SQRT_FAST); })
+BENCH_SINGLE_NAMED(LibAxis_SqrtLevelF_Precise, "LibAxis_SqrtLevelF/precise", { sink_f = LibAxis_SqrtLevelF(a_f[k], LA_SQRT_PRECISE); })
+BENCH_SINGLE_NAMED(LibAxis_RSqrtLevelF_Estimate, "LibAxis_RSqrtLevelF/estimate", { sink_f = LibAxis_RSqrtLevelF(a_f[k], LA_SQRT_ESTIMATE); })
+BENCH_SINGLE_NAMED(LibAxis_RSqrtLevelF_Fast, "LibAxis_RSqrtLevelF/fast", { sink_f = LibAxis_RSqrtLevelF(a_f[k], LA_SQRT_FAST); })
+BENCH_SINGLE_NAMED(LibAxis_RSqrtLevelF_Precise, "LibAxis_RSqrtLevelF/precise", { sink_f = LibAxis_RSqrtLevelF(a_f[k], LA_SQRT_PRECISE); })
+BENCH_BATCH_NAMED(LibAxis_SqrtArrayF_Estimate, "LibAxis_SqrtArrayF/estimate", BATCH, { LibAxis_SqrtArrayF(batch_out, batch_in, BATCH, LA_SQRT_ESTIMATE); })
+BENCH_BATCH_NAMED(LibAxis_SqrtArrayF_Fast, "LibAxis_SqrtArrayF/fast", BATCH, { LibAxis_SqrtArrayF(batch_out, batch_in, BATCH, LA_SQRT_FAST); })
+BENCH_BATCH_NAMED(LibAxis_SqrtArrayF_Precise, "LibAxis_SqrtArrayF/precise", BATCH, { LibAxis_SqrtArrayF(batch_out, batch_in, BATCH, LA_SQRT_PRECISE); })
+BENCH_BATCH_NAMED(LibAxis_RSqrtArrayF_Estimate, "LibAxis_RSqrtArrayF/estimate", BATCH, { LibAxis_RSqrtArrayF(batch_out, batch_in, BATCH, LA_SQRT_ESTIMATE); })
+BENCH_BATCH_NAMED(LibAxis_RSqrtArrayF_Fast, "LibAxis_RSqrtArrayF/fast", BATCH, { LibAxis_RSqrtArrayF(batch_out, batch_in, BATCH, LA_SQRT_FAST); })
+BENCH_BATCH_NAMED(LibAxis_RSqrtArrayF_Precise, "LibAxis_RSqrtArrayF/precise", BATCH, { LibAxis_RSqrtArrayF(batch_out, batch_in, BATCH, LA_SQRT_PRECISE); })
+BENCH_BATCH(LibAxis_SinCosArrayF, BATCH, { LibAxis_SinCosArrayF(batch_out, batch_out2, batch_in, BATCH); })
+BENCH_SINGLE_NAMED(ReactOS_sin, "sin", { sink_f = (float)sin((double)a_f[k]); })
+BENCH_SINGLE_NAMED(ReactOS_cos, "cos", { sink_f = (float)cos((double)a_f[k]); })
+
+/* ---- color.c ---------------------------------------------------------- */
+
+BENCH_SINGLE(LibAxis_Color_RGBToHSV, { float h, s, v; LibAxis_Color_RGBToHSV(a_u8[k * 3], a_u8[k * 3 + 1], a_u8[k * 3 + 2], &h, &s, &v); sink_f = h + s + v; })
+BENCH_SINGLE(LibAxis_Color_HSVToRGB, { uint8_t r, g, b; LibAxis_Color_HSVToRGB(a_f[k] * 59.0f, b_f[k] * 0.33f, 0.75f, &r, &g, &b); sink_i = r + g + b; })
+BENCH_SINGLE(LibAxis_Color_CycleHue, { float h = a_f[k] * 59.0f; LibAxis_Color_CycleHue(&h, 1.5f); sink_f = h; })
+BENCH_SINGLE(LibAxis_Color_LerpCosine, { float v; LibAxis_Color_LerpCosine(&v, a_f[k], 0.25f); sink_f = v; })
+BENCH_SINGLE(LibAxis_Color_LerpRBA32Percent, { sink_i = LibAxis_Color_LerpRBA32Percent(a_u32[k], b_u32[k], 0.5f).rgba; })
+BENCH_BATCH(LibAxis_Color_RGBA32ToHSVArray, POOL, { LibAxis_Color_RGBA32ToHSVArray(hsv_pool, (Color_RGBA32*)a_u32, POOL); })
+BENCH_BATCH(LibAxis_Color_RGBA32ToHSVArrayLUT, POOL, { LibAxis_Color_RGBA32ToHSVArrayLUT(hsv_pool, (Color_RGBA32*)a_u32, POOL); })
+BENCH_BATCH(LibAxis_Color_HSVToRGBA32Array, POOL, { LibAxis_Color_HSVToRGBA32Array((Color_RGBA32*)b_u32, hsv_pool, POOL); })
+BENCH_BATCH(LibAxis_Color_AdjustHSVArray, POOL, { LibAxis_Color_AdjustHSVArray((Color_RGBA32*)b_u32, (Color_RGBA32*)a_u32, POOL, 90.0f, 0.8f, 1.1f); })
+BENCH_BATCH(LibAxis_Color_RGBToHSVPlanar, POOL, { LibAxis_Color_RGBToHSVPlanar(hsv_plane[0], hsv_plane[1], hsv_plane[2], a_u8, a_u8 + POOL, a_u8 + (POOL * 2), POOL); })
+BENCH_BATCH(LibAxis_Color_HSVToRGBPlanar, POOL, { LibAxis_Color_HSVToRGBPlanar(rgb_plane[0], rgb_plane[1], rgb_plane[2], hsv_plane[0], hsv_plane[1], hsv_plane[2], POOL); })
+
+/* ---- texture.c -------------------------------------------------------- */
+#define BENCH_TEXTURE(NAME, DST, DFMT, SRC, SFMT, FLAGS) \
+    BENCH_BATCH_NAMED(LibAxis_Texture_Convert_##NAME, "LibAxis_Texture_Convert " #NAME, TEX * TEX, { sink_i += LibAxis_Texture_Convert(DST, DFMT, SRC, SFMT, TEX, TEX, FLAGS); })
+
+BENCH_SINGLE(LibAxis_Texture_Size, { sink_i += LibAxis_Texture_Size(k & 7, TEX, TEX); })
+BENCH_TEXTURE(RGBA32_RGBA16, tex_rgba16, LA_TEXFMT_RGBA16, tex_rgba32, LA_TEXFMT_RGBA32, 0)
+BENCH_TEXTURE(RGBA32_RGBA16_Dither, tex_rgba16, LA_TEXFMT_RGBA16, tex_rgba32, LA_TEXFMT_RGBA32, LA_TEXTURE_DITHER)
+BENCH_TEXTURE(RGBA16_RGBA32, tex_rgba32, LA_TEXFMT_RGBA32, tex_rgba16, LA_TEXFMT_RGBA16, 0)
+BENCH_TEXTURE(RGB24_RGBA32, tex_rgba32, LA_TEXFMT_RGBA32, tex_rgb24, LA_TEXFMT_RGB24, 0)
+BENCH_TEXTURE(RGBA32_RGB24, tex_rgb24, LA_TEXFMT_RGB24, tex_rgba32, LA_TEXFMT_RGBA32, 0)
+BENCH_TEXTURE(RGB24_RGBA16, tex_rgba16, LA_TEXFMT_RGBA16, tex_rgb24, LA_TEXFMT_RGB24, 0)
+BENCH_TEXTURE(RGBA32_IA8_Dither, tex_small, LA_TEXFMT_IA8, tex_rgba32, LA_TEXFMT_RGBA32, LA_TEXTURE_DITHER)
+BENCH_TEXTURE(RGBA32_I4, tex_small, LA_TEXFMT_I4, tex_rgba32, LA_TEXFMT_RGBA32, 0)
+
+/* ---- matrix.c --------------------------------------------------------- */
+
+BENCH_SINGLE(LibAxis_Matrix44ToFixed44, { LibAxis_Matrix44ToFixed44(&mfx[k & (MPOOL - 1)], ma[k & (MPOOL - 1)]); })
+BENCH_BATCH(LibAxis_Matrix44ToFixed44Array, MPOOL, { LibAxis_Matrix44ToFixed44Array(mfx, ma, MPOOL); })
+BENCH_SINGLE(LibAxis_Fixed44ToMatrix44, { LibAxis_Fixed44ToMatrix44(mo[k & (MPOOL - 1)], &mfx[k & (MPOOL - 1)]); })
+BENCH_BATCH(LibAxis_Fixed44ToMatrix44Array, MPOOL, { LibAxis_Fixed44ToMatrix44Array(mo, mfx, MPOOL); })
+BENCH_SINGLE(LibAxis_Matrix44_IdentityF, { LibAxis_Matrix44_IdentityF(mo[k & (MPOOL - 1)]); })
+BENCH_SINGLE(LibAxis_Matrix44_TranslateF, { LibAxis_Matrix44_TranslateF(mo[k & (MPOOL - 1)], a_f[k], b_f[k], 1.0f); })
+BENCH_SINGLE(LibAxis_Matrix44_ScaleF, { LibAxis_Matrix44_ScaleF(mo[k & (MPOOL - 1)], a_f[k], b_f[k], 1.0f); })
+BENCH_SINGLE(LibAxis_Matrix44_RotateF, { LibAxis_Matrix44_RotateF(mo[k & (MPOOL - 1)], a_f[k] * 60.0f, b_f[k] * 60.0f, 30.0f); })
+BENCH_SINGLE(LibAxis_Matrix44_PerspectiveF, { LibAxis_Matrix44_PerspectiveF(mo[k & (MPOOL - 1)], 60.0f + a_f[k], 1.5f, 0.1f, 1000.0f); })
+BENCH_SINGLE(LibAxis_Matrix44_OrthographicF, { LibAxis_Matrix44_OrthographicF(mo[k & (MPOOL - 1)], -a_f[k], a_f[k], -b_f[k], b_f[k], 0.1f, 1000.0f); })
+BENCH_SINGLE(LibAxis_Matrix44_LookAtF, { LibAxis_Matrix44_LookAtF(mo[k & (MPOOL - 1)], &a_Vec3f[k], &b_Vec3f[k], &a_Vec3f[(k + 1) & (POOL - 1)]); })
+BENCH_SINGLE(LibAxis_Matrix44_MultiplyF, { LibAxis_Matrix44_MultiplyF(ma[k & (MPOOL - 1)], mb[k & (MPOOL - 1)], mo[k & (MPOOL - 1)]); })
+BENCH_BATCH(LibAxis_Matrix44_MultiplyArrayF, MPOOL, { LibAxis_Matrix44_MultiplyArrayF(ma, mb, mo, MPOOL); })
+BENCH_BATCH(LibAxis_Matrix44_PreMultiplyArrayF, MPOOL, { LibAxis_Matrix44_PreMultiplyArrayF(ma[0], mb, mo, MPOOL); })
+BENCH_BATCH(LibAxis_Matrix44_PostMultiplyArrayF, MPOOL, { LibAxis_Matrix44_PostMultiplyArrayF(ma, mb[0], mo, MPOOL); })
+BENCH_SINGLE(LibAxis_Matrix44_TransposeF, { LibAxis_Matrix44_TransposeF(mo[k & (MPOOL - 1)]); })
+BENCH_BATCH(LibAxis_Matrix44_TransposeArrayF, MPOOL, { LibAxis_Matrix44_TransposeArrayF(mo, MPOOL); })
+BENCH_SINGLE(LibAxis_Matrix44_InverseF, { sink_i += LibAxis_Matrix44_InverseF(ma[k & (MPOOL - 1)], mo[k & (MPOOL - 1)]); })
+BENCH_BATCH(LibAxis_Matrix44_InverseArrayF, MPOOL, { sink_i += LibAxis_Matrix44_InverseArrayF(ma, mo, MPOOL); })
+BENCH_SINGLE(LibAxis_Matrix44_InverseAffineF, { sink_i += LibAxis_Matrix44_InverseAffineF(mr[k & (MPOOL - 1)], mo[k & (MPOOL - 1)]); })
+BENCH_BATCH(LibAxis_Matrix44_InverseAffineArrayF, MPOOL, { sink_i += LibAxis_Matrix44_InverseAffineArrayF(mr, mo, MPOOL); })
+BENCH_SINGLE(LibAxis_Matrix44_InverseRigidF, { LibAxis_Matrix44_InverseRigidF(mr[k & (MPOOL - 1)], mo[k & (MPOOL - 1)]); })
+BENCH_BATCH(LibAxis_Matrix44_InverseRigidArrayF, MPOOL, { LibAxis_Matrix44_InverseRigidArrayF(mr, mo, MPOOL); })
+BENCH_SINGLE(LibAxis_Matrix44_TransformPointF, { o_Vec3f[k] = LibAxis_Matrix44_TransformPointF(ma[k & (MPOOL - 1)], &a_Vec3f[k]); })
+BENCH_SINGLE(LibAxis_Matrix44_TransformVectorF, { o_Vec3f[k] = LibAxis_Matrix44_TransformVectorF(ma[k & (MPOOL - 1)], &a_Vec3f[k]); })
+BENCH_SINGLE(LibAxis_Matrix44_ProjectPointF, { o_Vec3f[k] = LibAxis_Matrix44_ProjectPointF(ma[k & (MPOOL - 1)], &a_Vec3f[k]); })
+BENCH_SINGLE(LibAxis_Matrix44_TransformVec4F, { o_Vec4f[k] = LibAxis_Matrix44_TransformVec4F(ma[k & (MPOOL - 1)], &a_Vec4f[k]); })
+BENCH_BATCH(LibAxis_Matrix44_TransformPointArrayF, POOL, { LibAxis_Matrix44_TransformPointArrayF(ma[0], o_Vec3f, a_Vec3f, POOL); })
+BENCH_BATCH(LibAxis_Matrix44_TransformVectorArrayF, POOL, { LibAxis_Matrix44_TransformVectorArrayF(ma[0], o_Vec3f, a_Vec3f, POOL); })
+BENCH_BATCH(LibAxis_Matrix44_ProjectPointArrayF, POOL, { LibAxis_Matrix44_ProjectPointArrayF(ma[0], o_Vec3f, a_Vec3f, POOL); })
+BENCH_BATCH(LibAxis_Matrix44_TransformVec4ArrayF, POOL, { LibAxis_Matrix44_TransformVec4ArrayF(ma[0], o_Vec4f, a_Vec4f, POOL); })
+BENCH_BATCH(LibAxis_Matrix44_TransformPointStridedF, POOL, { LibAxis_Matrix44_TransformPointStridedF(ma[0], o_Vec4f, sizeof(Vec4f), a_Vec4f, sizeof(Vec4f), POOL); })
+BENCH_BATCH(LibAxis_Matrix44_TransformVectorStridedF, POOL, { LibAxis_Matrix44_TransformVectorStridedF(ma[0], o_Vec4f, sizeof(Vec4f), a_Vec4f, sizeof(Vec4f), POOL); })
+BENCH_BATCH(LibAxis_Matrix44_ProjectPointStridedF, POOL, { LibAxis_Matrix44_ProjectPointStridedF(ma[0], o_Vec4f, sizeof(Vec4f), a_Vec4f, sizeof(Vec4f), POOL); })
+BENCH_BATCH(LibAxis_Matrix44_TransformPointStreamF, BATCH, { LibAxis_Matrix44_TransformPointStreamF(ma[0], &s3[2], &s3[0]); })
+BENCH_BATCH(LibAxis_Matrix44_TransformVectorStreamF, BATCH, { LibAxis_Matrix44_TransformVectorStreamF(ma[0], &s3[2], &s3[0]); })
+BENCH_BATCH(LibAxis_Matrix44_TransformVec4StreamF, BATCH, { LibAxis_Matrix44_TransformVec4StreamF(ma[0], &s4[2], &s4[0]); })
+BENCH_BATCH(LibAxis_Matrix44_ProjectPointStreamF, BATCH, { LibAxis_Matrix44_ProjectPointStreamF(ma[0], &s3[2], &s3[0]); })
+BENCH_SINGLE(LibAxis_Matrix43_IdentityF, { LibAxis_Matrix43_IdentityF(m43o[k & (MPOOL - 1)]); })
+BENCH_SINGLE(LibAxis_Matrix43_MultiplyF, { LibAxis_Matrix43_MultiplyF(m43a[k & (MPOOL - 1)], m43b[k & (MPOOL - 1)], m43o[k & (MPOOL - 1)]); })
+BENCH_BATCH(LibAxis_Matrix43_MultiplyArrayF, MPOOL, { LibAxis_Matrix43_MultiplyArrayF(m43a, m43b, m43o, MPOOL); })
+BENCH_BATCH(LibAxis_Matrix43_PostMultiplyArrayF, MPOOL, { LibAxis_Matrix43_PostMultiplyArrayF(m43a, m43b[0], m43o, MPOOL); })
+BENCH_SINGLE(LibAxis_Matrix43_TransformPointF, { o_Vec3f[k] = LibAxis_Matrix43_TransformPointF(m43a[k & (MPOOL - 1)], &a_Vec3f[k]); })
+BENCH_SINGLE(LibAxis_Matrix43_TransformVectorF, { o_Vec3f[k] = LibAxis_Matrix43_TransformVectorF(m43a[k & (MPOOL - 1)], &a_Vec3f[k]); })
+BENCH_BATCH(LibAxis_Matrix43_TransformPointArrayF, POOL, { LibAxis_Matrix43_TransformPointArrayF(m43a[0], o_Vec3f, a_Vec3f, POOL); })
+BENCH_BATCH(LibAxis_Matrix43_TransformVectorArrayF, POOL, { LibAxis_Matrix43_TransformVectorArrayF(m43a[0], o_Vec3f, a_Vec3f, POOL); })
+BENCH_SINGLE(LibAxis_Matrix43_InverseF, { sink_i += LibAxis_Matrix43_InverseF(m43a[k & (MPOOL - 1)], m43o[k & (MPOOL - 1)]); })
+BENCH_SINGLE(LibAxis_Matrix43ToMatrix44F, { LibAxis_Matrix43ToMatrix44F(m43a[k & (MPOOL - 1)], mo[k & (MPOOL - 1)]); })
+BENCH_SINGLE(LibAxis_Matrix44ToMatrix43F, { LibAxis_Matrix44ToMatrix43F(ma[k & (MPOOL - 1)], m43o[k & (MPOOL - 1)]); })
+BENCH_SINGLE(LibAxis_Matrix43ToFixed44, { LibAxis_Matrix43ToFixed44(&mfx[k & (MPOOL - 1)], m43a[k & (MPOOL - 1)]); })
+
+/* ---- runner ----------------------------------------------------------- */
+
+static double Bench_Now(void) {
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec * 1e9 + (double)ts.tv_nsec;
+}
+
+/* Grow the iteration count until one run takes min_ns, then keep the best of three runs. */
+static void Bench_Run(const BenchCase* bench, double min_ns, BenchResult* result) {
+    uint32_t iters = 16;
+    double start, elapsed, best;
+    int32_t rep;
+
+    for (;;) {
+        start = Bench_Now();
+        bench->fn(iters);
+        elapsed = Bench_Now() - start;
+        if (elapsed >= min_ns || iters >= (1u << 30))
+            break;
+        iters *= (elapsed * 8.0 < min_ns) ? 8 : 2;
+    }
+
+    best = elapsed;
+    for (rep = 0; rep < 2; rep++) {
+        start = Bench_Now();
+        bench->fn(iters);
+        elapsed = Bench_Now() - start;
+        if (elapsed < best)
+            best = elapsed;
+    }
+
+    result->bench = bench;
+    result->ns_per_op = best / ((double)iters * bench->elems);
+    result->ops_per_sec = 1e9 / result->ns_per_op;
+}
+
+static const char* Bench_IsaName(void) {
+    switch (LA_SIMD) {
+        case LA_SIMD_AVX2: return "avx2";
+        case LA_SIMD_SSE2: return "sse2";
+        case LA_SIMD_NEON: return "neon";
+        default:           return "scalar";
+    }
+}
+
+/* The set of dispatched batch kernels being timed. */
+static const char* Bench_KernelsName(void) {
+    return (bench_kernels == LA_CPU_AVX2) ? "avx2" : "base";
+}
+
+static void Bench_WriteJson(FILE* f, const BenchResult* results, uint32_t count) {
+    uint32_t n;
+
+    fprintf(f, "{\n  \"isa\": \"%s\",\n  \"simd_width\": %d,\n  \"kernels\": \"%s\",\n  \"results\": [\n", Bench_IsaName(), LA_SIMD_WIDTH, Bench_KernelsName());
+    for (n = 0; n < count; n++) {
+        fprintf(f, "    {\"name\": \"%s\", \"mode\": \"%s\", \"elems_per_call\": %u, \"ns_per_op\": %.4f, \"ops_per_sec\": %.1f}%s\n",
+            results[n].bench->name, results[n].bench->mode, results[n].bench->elems,
+            results[n].ns_per_op, results[n].ops_per_sec, (n + 1 < count) ? "," : "");
+    }
+    fprintf(f, "  ]\n}\n");
+}
+
+int main(int argc, char** argv) {
+    static BenchResult results[BENCH_MAX_CASES];
+    const char* filter = NULL;
+    const char* json = NULL;
+    double min_ns = 20e6;
+    uint32_t n, count = 0;
+    int32_t arg;
+    FILE* f;
+
+    for (arg = 1; arg < argc; arg++) {
+        if (strcmp(argv[arg], "--filter") == 0 && arg + 1 < argc) {
+            filter = argv[++arg];
+        } else if (strcmp(argv[arg], "--min-ms") == 0 && arg + 1 < argc) {
+            min_ns = 0.0;
+            for (const char* p = argv[++arg]; *p >= '0' && *p <= '9'; p++)
+                min_ns = min_ns * 10.0 + (*p - '0');
+            min_ns *= 1e6;
+        } else if (strcmp(argv[arg], "--json") == 0 && arg + 1 < argc) {
+            json = argv[++arg];
+        } else if (strcmp(argv[arg], "--base") == 0) {
+            bench_dispatch = 0;
+        } else {
+            fprintf(stderr, "usage: %s [--filter SUBSTRING] [--min-ms MS] [--json FILE|-] [--base]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    if (bench_dropped != 0) {
+        fprintf(stderr, "bench: %u cases did not fit in BENCH_MAX_CASES (%d); raise it\n", bench_dropped, BENCH_MAX_CASES);
+        return 1;
+    }
+
+    bench_kernels = LibAxis_Dispatch_Init(bench_dispatch);
+    Bench_Setup();
+    Bench_SetupStreams();
+    Bench_BuildTree();
+    Bench_SetupCull();
+    Bench_SetupBvh();
+    Bench_SetupGrid();
+    Bench_SetupFixed();
+    Bench_SetupRays();
+    Bench_SetupMatrixStack();
+    LibAxis_Arena_Init(&arena, arena_buf, sizeof(arena_buf));
+    LibAxis_Jobs_Init(&jobs, job_queues, 1, NULL);
+
+    if ((filter == NULL || strstr("LibAxis_Jobs_ParallelFor", filter) != NULL) && !Bench_CheckJobs())
+        return 1;
+
+    if (json == NULL || strcmp(json, "-") != 0)
+        printf("libaxis bench (%s, %d lanes, %s kernels)\n%-44s %-6s %12s %16s\n", Bench_IsaName(), LA_SIMD_WIDTH, Bench_KernelsName(), "function", "mode", "ns/op", "ops/s");
+
+    for (n = 0; n < bench_count; n++) {
+        if (filter != NULL && strstr(bench_cases[n].name, filter) == NULL)
+            continue;
+
+        Bench_Run(&bench_cases[n], min_ns, &results[count]);
+        if (json == NULL || strcmp(json, "-") != 0) {
+            printf("%-44s %-6s %12.3f %16.0f\n", bench_cases[n].name, bench_cases[n].mode, results[count].ns_per_op, results[count].ops_per_sec);
+            fflush(stdout);
+        }
+        count++;
+    }
+
+    if (json != NULL) {
+        f = (strcmp(json, "-") == 0) ? stdout : fopen(json, "w");
+        if (f == NULL) {
+            fprintf(stderr, "could not open %s\n", json);
+            return 1;
+        }
+        Bench_WriteJson(f, results, count);
+        if (f != stdout)
+            fclose(f);
+    }
+
+    return 0;
+}
@@ -0,0 +1,27 @@
+#ifndef LIBAXIS_ARENA_H
+#define LIBAXIS_ARENA_H
+
+/*
+ * A bump-pointer arena for per-frame scratch memory (stream planes, matrix
+ * arrays, culling lists) in builds without malloc. It hands out aligned
+ * pieces of one caller-owned buffer, and nothing is freed on its own: take a
+ * mark before some temporary work and rewind to it afterwards, or reset the
+ * whole arena once per frame.
+ *
+ * An arena has no lock. Give every thread its own arena, and use
+ * LibAxis_Arena_Alloc on it. LibAxis_Arena_AllocShared lets several threads
+ * allocate from one arena at once without a lock; marks, rewinds and resets
+ * of a shared arena must still happen while no thread is allocating.
+ *
+ * A failed allocation returns NULL and leaves the arena unchanged.
+ */
+#define LA_ARENA_ALIGN 16 /* Enough for LA_F32x4; use LA_STREAM_ALIGN or 64 for wider data */
+
+typedef struct {
+    uint8_t* base;
+    uint32_t size;
+    uint32_t offset;  /* Bytes in use */
+    uint32_t peak;    /* Highest offset seen by Alloc, Rewind and Reset, for sizing the buffer */
+} Arena;
+
+#endif /* LIBAXIS_ARENA_H */
@@ -0,0 +1,44 @@
+#ifndef LIBAXIS_BVH_H
+#define LIBAXIS_BVH_H
+
+/*
+ * A bounding volume hierarchy over triangles or axis-aligned boxes, built
+ * top-down with a binned surface area heuristic (LA_BVH_BINS bins along the
+ * longest centroid axis). A node of up to LA_BVH_LEAF_MAX primitives is kept
+ * as a leaf when no split is cheaper.
+ *
+ * Nodes are 32 bytes. The two children of a node are allocated side by side,
+ * and node 1 is left unused so every pair starts on an even index. With a 64
+ * byte aligned buffer a traversal step then reads exactly one cache line. A
+ * leaf (count > 0) covers index[first .. first + count). An interior node
+ * (count == 0) has its children at first and first + 1, which are always
+ * after the node itself. Refitting is therefore a single reverse sweep.
+ *
+ * Everything lives in one caller-owned buffer of LA_BVH_BYTES(capacity)
+ * bytes. Traversal uses a fixed stack, so the build stops splitting at
+ * LA_BVH_MAX_DEPTH.
+ */
+#define LA_BVH_NONE (-1)
+#define LA_BVH_BINS 12
+#define LA_BVH_LEAF_MAX 4
+#define LA_BVH_MAX_DEPTH 48
+#define LA_BVH_BYTES(CAPACITY) ((uint32_t)(CAPACITY) * ((sizeof(BvhNode) * 2) + sizeof(uint32_t) + (sizeof(Vec3f) * 2)))
+
+typedef struct {
+    Vec3f min;
+    uint32_t first;
+    Vec3f max;
+    uint32_t count;
+} BvhNode;
+
+typedef struct {
+    BvhNode* nodes;
+    uint32_t* index;     /* Primitive indices, in leaf order */
+    Vec3f* bounds;       /* Min and max of every primitive, in primitive order */
+    Vec3f* triangles;    /* Three vertices per primitive, or NULL for a box hierarchy */
+    uint32_t node_count;
+    uint32_t count;
+    uint32_t capacity;
+} Bvh;
+
+#endif /* LIBAXIS_BVH_H */
\ No newline at end of file
@@ -0,0 +1,40 @@
+#ifndef LIBAXIS_CAMERA_H
+#define LIBAXIS_CAMERA_H
+
+/*
+ * A camera that owns one set of view, projection and combined
+ * view-projection matrices (clip = v * view_projection), plus the frustum
+ * planes of view_projection, for culling, picking and shadow passes to share.
+ *
+ * The setters only record parameters. A setter given the values the camera
+ * already has changes nothing, so they can be called every frame.
+ * LibAxis_Camera_Update rebuilds whatever the changed parameters affect and
+ * returns at once when nothing changed. The inverse view-projection is only
+ * needed for picking, so it is rebuilt separately, by
+ * LibAxis_Camera_UpdateInverse, the first time it is asked for after a change.
+ *
+ * The matrix fields are read-only for the caller; they are valid after
+ * LibAxis_Camera_Update (inverse after LibAxis_Camera_UpdateInverse).
+ */
+#define LA_CAMERA_PERSPECTIVE   0
+#define LA_CAMERA_ORTHOGRAPHIC  1
+
+#define LA_CAMERA_DIRTY_VIEW        0x01
+#define LA_CAMERA_DIRTY_PROJECTION  0x02
+#define LA_CAMERA_DIRTY_INVERSE     0x04
+
+typedef struct {
+    float view[4][4];
+    float projection[4][4];
+    float view_projection[4][4];
+    float inverse[4][4];   /* Inverse of view_projection */
+    Frustum frustum;       /* Planes of view_projection */
+    Vec3f eye;
+    Vec3f target;
+    Vec3f up;
+    float lens[6];         /* fov_y, aspect, near, far; or left, right, bottom, top, near, far */
+    int32_t mode;          /* LA_CAMERA_PERSPECTIVE or LA_CAMERA_ORTHOGRAPHIC */
+    uint32_t dirty;        /* LA_CAMERA_DIRTY_* */
+} Camera;
+
+#endif /* LIBAXIS_CAMERA_H */
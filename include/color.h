@@ -1,11 +1,17 @@
 #ifndef LIBAXIS_COLOR_H
 #define LIBAXIS_COLOR_H
 
-#define COLOR16_TO_COLOR32(CARG0) (                 \
-      COLOR32((((CARG0) & 0xF800) >> 11) /* red */  \
-    , (((CARG0) & 0x07C0) >> 6) /* green */         \
-    , (((CARG0) & 0x003E) >> 1) /* blue  */         \
-    , ((((CARG0) & 0x1) > 0) ? 255 : 0) /* alpha */ \
+/* Widen an N-bit channel to 8 bits by bit replication, so 0 maps to 0 and the maximum to 255. */
+#define COLOR_EXPAND5(V) ((((V) & 0x1F) << 3) | (((V) & 0x1F) >> 2))
+#define COLOR_EXPAND4(V) (((V) & 0xF) * 0x11)
+#define COLOR_EXPAND3(V) ((((V) & 0x7) << 5) | (((V) & 0x7) << 2) | (((V) & 0x7) >> 1))
+#define COLOR_EXPAND1(V) (((V) & 0x1) ? 255 : 0)
+
+#define COLOR16_TO_COLOR32(CARG0) (                                \
+      COLOR32(COLOR_EXPAND5(((CARG0) & 0xF800) >> 11) /* red */   \
+    , COLOR_EXPAND5(((CARG0) & 0x07C0) >> 6) /* green */          \
+    , COLOR_EXPAND5(((CARG0) & 0x003E) >> 1) /* blue  */          \
+    , COLOR_EXPAND1((CARG0)) /* alpha */                          \
 ))
 
 #define COLOR32_TO_COLOR16(CARG0) (              \
@@ -21,6 +27,21 @@
 #define C16TO32(CARG0) COLOR16_TO_COLOR32((CARG0))
 #define C32TO16(CARG0) COLOR32_TO_COLOR16((CARG0))
 
+/* Bit positions of the channels when a Color_RGBA32 is read as a native uint32_t. */
+#if (__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__)
+#define LA_RGBA32_SHIFT_R 0
+#define LA_RGBA32_SHIFT_G 8
+#define LA_RGBA32_SHIFT_B 16
+#define LA_RGBA32_SHIFT_A 24
+#else
+#define LA_RGBA32_SHIFT_R 24
+#define LA_RGBA32_SHIFT_G 16
+#define LA_RGBA32_SHIFT_B 8
+#define LA_RGBA32_SHIFT_A 0
+#endif
+
+#define LA_RGBA32_ALPHA ((int32_t)(0xFFu << LA_RGBA32_SHIFT_A))
+
 #ifdef __LA_STANDALONE__
 
 typedef union rgb8_color {
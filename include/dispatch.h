@@ -0,0 +1,76 @@
+#ifndef LIBAXIS_DISPATCH_H
+#define LIBAXIS_DISPATCH_H
+
+/*
+ * Runtime kernel selection for x86 builds. The batch kernels listed in
+ * LA_DISPATCH_KERNELS are compiled twice: once with the flags of the build
+ * (NAME_Base) and once more by dispatch_avx2.c for AVX2 (NAME_AVX2). The
+ * public NAME is a stub that calls through a table, bound to the base set
+ * until LibAxis_Dispatch_Init picks the best set for the host's cpuid
+ * features. It runs automatically when the library is loaded by a hosted
+ * program, and may be called again to restrict the choice.
+ *
+ * AVX-512 hosts get the AVX2 kernels: the streams are padded to 8 lanes
+ * (LA_STREAM_LANES), so a 16-lane set would not fit their layout.
+ * Other targets, or builds with -DLA_NO_DISPATCH, call the kernels directly.
+ */
+#define LA_CPU_SSE2     0x00000001
+#define LA_CPU_SSE41    0x00000002
+#define LA_CPU_AVX      0x00000004
+#define LA_CPU_FMA      0x00000008
+#define LA_CPU_AVX2     0x00000010
+#define LA_CPU_AVX512F  0x00000020
+#define LA_CPU_ALL      0xFFFFFFFF
+
+#if (defined(__x86_64__) || defined(__i386__)) && !defined(LA_NO_DISPATCH)
+#define LA_DISPATCH 1
+#else
+#define LA_DISPATCH 0
+#endif
+
+/* Definition name of a dispatched kernel. dispatch_avx2.c defines its own before including the modules. */
+#ifndef LA_KERNEL
+#if LA_DISPATCH
+#define LA_KERNEL(NAME) NAME##_Base
+#else
+#define LA_KERNEL(NAME) NAME
+#endif
+#endif
+
+/* X(NAME, PARAMS, ARGS) for every dispatched kernel; all of them return void. */
+#define LA_DISPATCH_KERNELS(X) \
+    X(LibAxis_SinCosArrayF, (float* s, float* c, float* in, uint32_t count), (s, c, in, count)) \
+    X(LibAxis_SqrtArrayF, (float* out, float* in, uint32_t count, int32_t accuracy), (out, in, count, accuracy)) \
+    X(LibAxis_RSqrtArrayF, (float* out, float* in, uint32_t count, int32_t accuracy), (out, in, count, accuracy)) \
+    X(Vec3fStream_Add, (Vec3fStream* out, Vec3fStream* lhs, Vec3fStream* rhs), (out, lhs, rhs)) \
+    X(Vec3fStream_Sub, (Vec3fStream* out, Vec3fStream* lhs, Vec3fStream* rhs), (out, lhs, rhs)) \
+    X(Vec3fStream_Multiply, (Vec3fStream* out, Vec3fStream* lhs, Vec3fStream* rhs), (out, lhs, rhs)) \
+    X(Vec3fStream_MultiplyF, (Vec3fStream* out, Vec3fStream* lhs, float rhs), (out, lhs, rhs)) \
+    X(Vec3fStream_Dot, (float* out, Vec3fStream* lhs, Vec3fStream* rhs), (out, lhs, rhs)) \
+    X(Vec3fStream_Cross, (Vec3fStream* out, Vec3fStream* lhs, Vec3fStream* rhs), (out, lhs, rhs)) \
+    X(Vec3fStream_Normalize, (Vec3fStream* out, Vec3fStream* lhs), (out, lhs)) \
+    X(Vec3fStream_Lerp, (Vec3fStream* out, Vec3fStream* lhs, Vec3fStream* rhs, float t), (out, lhs, rhs, t)) \
+    X(Vec4fStream_Add, (Vec4fStream* out, Vec4fStream* lhs, Vec4fStream* rhs), (out, lhs, rhs)) \
+    X(Vec4fStream_Sub, (Vec4fStream* out, Vec4fStream* lhs, Vec4fStream* rhs), (out, lhs, rhs)) \
+    X(Vec4fStream_Multiply, (Vec4fStream* out, Vec4fStream* lhs, Vec4fStream* rhs), (out, lhs, rhs)) \
+    X(Vec4fStream_MultiplyF, (Vec4fStream* out, Vec4fStream* lhs, float rhs), (out, lhs, rhs)) \
+    X(Vec4fStream_Dot, (float* out, Vec4fStream* lhs, Vec4fStream* rhs), (out, lhs, rhs)) \
+    X(Vec4fStream_Normalize, (Vec4fStream* out, Vec4fStream* lhs), (out, lhs)) \
+    X(Vec4fStream_Lerp, (Vec4fStream* out, Vec4fStream* lhs, Vec4fStream* rhs, float t), (out, lhs, rhs, t)) \
+    X(LibAxis_Color_RGBA32ToHSVArray, (Color_HSVf* hsv, Color_RGBA32* rgba, uint32_t count), (hsv, rgba, count)) \
+    X(LibAxis_Color_HSVToRGBA32Array, (Color_RGBA32* rgba, Color_HSVf* hsv, uint32_t count), (rgba, hsv, count)) \
+    X(LibAxis_Color_AdjustHSVArray, (Color_RGBA32* out, Color_RGBA32* in, uint32_t count, float hue, float saturation, float value), (out, in, count, hue, saturation, value)) \
+    X(LibAxis_Color_RGBToHSVPlanar, (float* h, float* s, float* v, uint8_t* r, uint8_t* g, uint8_t* b, uint32_t count), (h, s, v, r, g, b, count)) \
+    X(LibAxis_Color_HSVToRGBPlanar, (uint8_t* r, uint8_t* g, uint8_t* b, float* h, float* s, float* v, uint32_t count), (r, g, b, h, s, v, count)) \
+    X(LibAxis_Matrix44_MultiplyArrayF, (float mf_a[][4][4], float mf_b[][4][4], float mf[][4][4], uint32_t count), (mf_a, mf_b, mf, count)) \
+    X(LibAxis_Matrix44_PreMultiplyArrayF, (float mf_a[4][4], float mf_b[][4][4], float mf[][4][4], uint32_t count), (mf_a, mf_b, mf, count)) \
+    X(LibAxis_Matrix44_PostMultiplyArrayF, (float mf_a[][4][4], float mf_b[4][4], float mf[][4][4], uint32_t count), (mf_a, mf_b, mf, count)) \
+    X(LibAxis_Matrix44_TransformPointStreamF, (float mf[4][4], Vec3fStream* out, Vec3fStream* in), (mf, out, in)) \
+    X(LibAxis_Matrix44_TransformVectorStreamF, (float mf[4][4], Vec3fStream* out, Vec3fStream* in), (mf, out, in)) \
+    X(LibAxis_Matrix44_TransformVec4StreamF, (float mf[4][4], Vec4fStream* out, Vec4fStream* in), (mf, out, in)) \
+    X(LibAxis_Matrix44_ProjectPointStreamF, (float mf[4][4], Vec3fStream* out, Vec3fStream* in), (mf, out, in)) \
+    X(LibAxis_Ray_TrianglePacket, (RayHitStream* hits, Vec3fStream* origin, Vec3fStream* direction, Vec3f* v, int32_t index), (hits, origin, direction, v, index)) \
+    X(LibAxis_Ray_AABBPacket, (RayHitStream* hits, Vec3fStream* origin, Vec3fStream* direction, Vec3f* min, Vec3f* max, int32_t index), (hits, origin, direction, min, max, index)) \
+    X(LibAxis_Ray_SpherePacket, (RayHitStream* hits, Vec3fStream* origin, Vec3fStream* direction, Vec3f* center, float radius, int32_t index), (hits, origin, direction, center, radius, index))
+
+#endif /* LIBAXIS_DISPATCH_H */
@@ -0,0 +1,31 @@
+#ifndef LIBAXIS_FIXED_H
+#define LIBAXIS_FIXED_H
+
+/*
+ * Integer-only fixed-point arithmetic, for targets where the FPU is slow or
+ * stalls the pipeline. Scalars, Vec3i components and 4x4 matrices
+ * (qs1616_t mq[4][4], the same row-vector layout as float mf[4][4]) are
+ * Q16.16. Vec3s components are Q1.15, covering [-1, 1) as unit normals do.
+ *
+ * Results saturate to the range of their format instead of wrapping. Products
+ * are formed in 64 bits and rounded to nearest. The 64-bit work is limited to
+ * 32x32 -> 64 bit multiplies, adds and constant shifts, so 32-bit targets need
+ * no libgcc helpers.
+ * LibAxis_Fixed_PackMatrix44 writes a Mtx44 directly from Q16.16, bit for bit
+ * as LibAxis_Matrix44ToFixed44 would from the matching float matrix.
+ *
+ * Q1.15 cannot hold 1.0 itself; unit vectors come out with LA_Q15_MAX
+ * (0.99997) in place of it, and qs115() must only be given values below 1.
+ */
+typedef int16_t   qs115_t;
+#define qs115(n)                      ((qs115_t)((n)*0x00008000))
+
+#define LA_Q16_ONE                    ((qs1616_t)0x00010000)
+#define LA_Q16_MAX                    ((qs1616_t)0x7FFFFFFF)
+#define LA_Q16_MIN                    ((qs1616_t)(-0x7FFFFFFF - 1))
+#define LA_Q16_TOF(q)                 ((float)(q) * (1.0f / 65536.0f))
+#define LA_Q15_MAX                    ((qs115_t)0x7FFF)
+#define LA_Q15_MIN                    ((qs115_t)(-0x7FFF - 1))
+#define LA_Q15_TOF(q)                 ((float)(q) * (1.0f / 32768.0f))
+
+#endif /* LIBAXIS_FIXED_H */
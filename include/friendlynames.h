@@ -8,6 +8,7 @@
 #define powf LibAxis_PowF
 #define powi LibAxis_PowI
 #define sinf LibAxis_SinF
+#define sincosf LibAxis_SinCosF
 #define sqrtf LibAxis_SqrtF
 
 #endif /* LIBAXIS_FRIENDLY_NAMES_H */
\ No newline at end of file
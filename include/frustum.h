@@ -0,0 +1,28 @@
+#ifndef LIBAXIS_FRUSTUM_H
+#define LIBAXIS_FRUSTUM_H
+
+/*
+ * A view frustum as six planes (x, y, z, w): a point p is inside a plane when
+ * p.x * x + p.y * y + p.z * z + w >= 0. LibAxis_Frustum_FromMatrix44F extracts
+ * them from a combined view-projection matrix in the library's row-vector
+ * convention (clip = v * M) with a -w <= z <= w depth range, and normalizes
+ * them so the plane distance is in world units and can be compared against a
+ * sphere radius.
+ *
+ * The cull functions take their bounds as structure-of-arrays streams and
+ * write the indices of the visible objects, in order, into a caller array of
+ * at least count entries. They return how many were written.
+ */
+#define LA_FRUSTUM_LEFT   0
+#define LA_FRUSTUM_RIGHT  1
+#define LA_FRUSTUM_BOTTOM 2
+#define LA_FRUSTUM_TOP    3
+#define LA_FRUSTUM_NEAR   4
+#define LA_FRUSTUM_FAR    5
+#define LA_FRUSTUM_PLANES 6
+
+typedef struct {
+    Vec4f plane[LA_FRUSTUM_PLANES];
+} Frustum;
+
+#endif /* LIBAXIS_FRUSTUM_H */
\ No newline at end of file
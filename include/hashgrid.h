@@ -0,0 +1,39 @@
+#ifndef LIBAXIS_HASHGRID_H
+#define LIBAXIS_HASHGRID_H
+
+/*
+ * A spatial hash grid for broad-phase neighbor queries. Space is cut into
+ * cubes of cell_size. Each occupied cell is a Vec3i key in an open-addressed
+ * (linear probing) table, and it owns one contiguous range of the points,
+ * which are kept sorted by cell. A query then reads a few short, dense runs
+ * of positions instead of chasing per-point links.
+ *
+ * LibAxis_HashGrid_Build re-sorts all points in O(n) (count, prefix sum,
+ * scatter) and only clears the cells the previous build used, so rebuilding
+ * every frame is cheap. Everything lives in one caller-owned buffer of
+ * LA_HASHGRID_BYTES(capacity) bytes. The table has a power of two of at
+ * least 2 * capacity slots, so it is never more than half full.
+ */
+#define LA_HASHGRID_BYTES(CAPACITY) ((uint32_t)(CAPACITY) * ((sizeof(HashGridCell) * 4) + (sizeof(uint32_t) * 3) + sizeof(Vec3f)))
+
+typedef struct {
+    Vec3i cell;
+    uint32_t start;
+    uint32_t count;     /* 0 marks an empty slot */
+} HashGridCell;
+
+typedef struct {
+    HashGridCell* cells;
+    uint32_t* order;    /* Occupied slots, in the order their cells were first seen */
+    uint32_t* slot;     /* Slot of every input point, used while building */
+    uint32_t* index;    /* Input index of every sorted point */
+    Vec3f* sorted;      /* Points sorted by cell */
+    float cell_size;
+    float inverse;
+    uint32_t mask;      /* Slot count - 1 */
+    uint32_t cell_count;
+    uint32_t count;
+    uint32_t capacity;
+} HashGrid;
+
+#endif /* LIBAXIS_HASHGRID_H */
\ No newline at end of file
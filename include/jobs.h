@@ -0,0 +1,52 @@
+#ifndef LIBAXIS_JOBS_H
+#define LIBAXIS_JOBS_H
+
+/*
+ * A parallel-for for splitting batch work (array transforms, pose and color
+ * conversion, culling) across cores. The library cannot start threads in a
+ * -nostdlib build, so the host starts them: threads 1 .. worker_count - 1
+ * each call LibAxis_Jobs_Worker, which runs jobs until LibAxis_Jobs_Stop, and
+ * the thread that calls LibAxis_Jobs_ParallelFor works as worker 0. Only one
+ * thread issues jobs, and a job function must not issue jobs itself.
+ *
+ * [0, count) is cut into chunks of chunk elements (the last may be short).
+ * The cut depends only on count and chunk, never on the number of workers or
+ * on timing, so per-chunk results are the same on every machine. Each worker
+ * starts on its own contiguous share of the chunks, front to back; a worker
+ * that runs dry steals single chunks from the back of another's share. A job
+ * with one chunk, or a system with one worker, runs inline on the caller.
+ *
+ * The job function receives the worker index, to pick per-thread state such
+ * as an Arena. Idle workers spin on the idle callback (a CPU pause if NULL);
+ * pass the OS yield to give the cores back between jobs.
+ *
+ * Each worker's queue is one cache line out of a caller-owned buffer of
+ * LA_JOBS_BYTES(worker_count) bytes, 64 byte aligned. Targets without
+ * lock-free 64-bit atomics run every job inline.
+ */
+#define LA_JOBS_BYTES(WORKERS) ((uint32_t)(WORKERS) * sizeof(JobQueue))
+#define LA_JOBS_MAX_CHUNKS 0xFFFFFF
+
+typedef void (*JobFunc)(void* data, uint32_t begin, uint32_t end, uint32_t worker);
+
+typedef struct {
+    uint64_t range;     /* Job generation << 48 | first chunk << 24 | end chunk */
+    uint8_t pad[56];
+} JobQueue;
+
+typedef struct {
+    JobQueue* queues;
+    void (*idle)(void);
+    JobFunc func;
+    void* data;
+    uint32_t count;
+    uint32_t chunk;
+    uint32_t chunks;
+    uint32_t done;          /* Chunks finished in the current job */
+    uint32_t generation;    /* Bumped by every job that goes to the workers */
+    uint32_t active;        /* Workers inside a job; the issuer waits for 0 before the next */
+    uint32_t quit;
+    uint32_t worker_count;
+} JobSystem;
+
+#endif /* LIBAXIS_JOBS_H */
@@ -9,6 +9,11 @@ typedef signed int int32_t;
 typedef unsigned int uint32_t;
 typedef signed long long int64_t;
 typedef unsigned long long uint64_t;
+typedef __UINTPTR_TYPE__ uintptr_t;
+
+#ifndef NULL
+#define NULL ((void*)0)
+#endif
 
 #ifdef __ULTRATYPES__
 
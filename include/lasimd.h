@@ -0,0 +1,318 @@
+#ifndef LIBAXIS_SIMD_H
+#define LIBAXIS_SIMD_H
+
+/*
+ * Build-time SIMD selection. The instruction set is picked from whatever the
+ * compiler was told to target (see the x64/mips targets in the Makefile), so
+ * no intrinsic headers are needed; kernels are written with GCC vector
+ * extensions, which lower to SSE/AVX on x64, NEON on ARM and scalar code
+ * everywhere else.
+ */
+#define LA_SIMD_SCALAR 0
+#define LA_SIMD_SSE2   1
+#define LA_SIMD_AVX2   2
+#define LA_SIMD_NEON   3
+
+#ifndef LA_SIMD
+#if defined(__AVX2__)
+#define LA_SIMD LA_SIMD_AVX2
+#elif defined(__SSE2__)
+#define LA_SIMD LA_SIMD_SSE2
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define LA_SIMD LA_SIMD_NEON
+#else
+#define LA_SIMD LA_SIMD_SCALAR
+#endif
+#endif
+
+/* x64 builds can use the SSE square root and reciprocal estimate instructions. */
+#define LA_SIMD_X86 ((LA_SIMD == LA_SIMD_SSE2) || (LA_SIMD == LA_SIMD_AVX2))
+
+/* Mtx44 packing splits s15.16 elements with 16-bit lane shuffles, which assumes a little-endian host. */
+#define LA_SIMD_FIXED ((LA_SIMD != LA_SIMD_SCALAR) && (__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__))
+
+/* Number of float lanes processed per iteration by the batch kernels. */
+#if (LA_SIMD == LA_SIMD_AVX2)
+#define LA_SIMD_WIDTH 8
+#elif (LA_SIMD == LA_SIMD_SCALAR)
+#define LA_SIMD_WIDTH 1
+#else
+#define LA_SIMD_WIDTH 4
+#endif
+
+#define LA_ALIGN(N) __attribute__((aligned(N)))
+
+/* Small kernels that must be inlined even under -Os, so their vectors stay in registers. */
+#define LA_INLINE static inline __attribute__((always_inline))
+
+typedef float LA_F32x1 __attribute__((vector_size(4)));
+typedef float LA_F32x4 __attribute__((vector_size(16)));
+typedef float LA_F32x8 __attribute__((vector_size(32)));
+typedef int32_t LA_I32x1 __attribute__((vector_size(4)));
+typedef int32_t LA_I32x4 __attribute__((vector_size(16)));
+typedef int32_t LA_I32x8 __attribute__((vector_size(32)));
+typedef int16_t LA_I16x4 __attribute__((vector_size(8)));
+typedef int16_t LA_I16x8 __attribute__((vector_size(16)));
+typedef uint8_t LA_U8x16 __attribute__((vector_size(16)));
+
+/* Unaligned, alias-safe views for loading straight out of caller memory. */
+typedef float LA_F32x1u __attribute__((vector_size(4), aligned(4), may_alias));
+typedef float LA_F32x4u __attribute__((vector_size(16), aligned(4), may_alias));
+typedef float LA_F32x8u __attribute__((vector_size(32), aligned(4), may_alias));
+typedef int32_t LA_I32x1u __attribute__((vector_size(4), aligned(4), may_alias));
+typedef int32_t LA_I32x4u __attribute__((vector_size(16), aligned(4), may_alias));
+typedef int32_t LA_I32x8u __attribute__((vector_size(32), aligned(4), may_alias));
+typedef int16_t LA_I16x4u __attribute__((vector_size(8), aligned(1), may_alias));
+typedef int16_t LA_I16x8u __attribute__((vector_size(16), aligned(1), may_alias));
+typedef uint8_t LA_U8x16u __attribute__((vector_size(16), aligned(1), may_alias));
+
+#define LA_LOAD4(PTR)        (*(const LA_F32x4u*)(PTR))
+#define LA_STORE4(PTR, V)    (*(LA_F32x4u*)(PTR) = (V))
+#define LA_LOAD8(PTR)        (*(const LA_F32x8u*)(PTR))
+#define LA_STORE8(PTR, V)    (*(LA_F32x8u*)(PTR) = (V))
+
+/* Native-width vector: LA_SIMD_WIDTH lanes (a single lane on scalar builds). */
+#if (LA_SIMD_WIDTH == 8)
+typedef LA_F32x8 LA_F32xN;
+typedef LA_I32x8 LA_I32xN;
+typedef LA_F32x8u LA_F32xNu;
+typedef LA_I32x8u LA_I32xNu;
+typedef LA_I16x8 LA_I16xN;
+typedef LA_I16x8u LA_I16xNu;
+#elif (LA_SIMD_WIDTH == 4)
+typedef LA_F32x4 LA_F32xN;
+typedef LA_I32x4 LA_I32xN;
+typedef LA_F32x4u LA_F32xNu;
+typedef LA_I32x4u LA_I32xNu;
+typedef LA_I16x4 LA_I16xN;
+typedef LA_I16x4u LA_I16xNu;
+#else
+typedef LA_F32x1 LA_F32xN;
+typedef LA_I32x1 LA_I32xN;
+typedef LA_F32x1u LA_F32xNu;
+typedef LA_I32x1u LA_I32xNu;
+#endif
+
+#define LA_LOADN(PTR)        (*(const LA_F32xNu*)(PTR))
+#define LA_STOREN(PTR, V)    (*(LA_F32xNu*)(PTR) = (V))
+#define LA_LOADNI(PTR)       (*(const LA_I32xNu*)(PTR))
+#define LA_STORENI(PTR, V)   (*(LA_I32xNu*)(PTR) = (V))
+
+/* Four-lane shuffles: LA_SHUFFLE4 yields {A[X], A[Y], B[Z], B[W]}, LA_SWIZZLE4 yields {A[X], A[Y], A[Z], A[W]}. */
+#define LA_SHUFFLE4(A, B, X, Y, Z, W) __builtin_shuffle((A), (B), (LA_I32x4){(X), (Y), (Z) + 4, (W) + 4})
+#define LA_SWIZZLE4(A, X, Y, Z, W)    __builtin_shuffle((A), (LA_I32x4){(X), (Y), (Z), (W)})
+
+/* Transpose four rows of four lanes in place. */
+#define LA_TRANSPOSE4(R0, R1, R2, R3) do {                  \
+    LA_F32x4 la_t0_ = LA_SHUFFLE4((R0), (R1), 0, 1, 0, 1);  \
+    LA_F32x4 la_t1_ = LA_SHUFFLE4((R0), (R1), 2, 3, 2, 3);  \
+    LA_F32x4 la_t2_ = LA_SHUFFLE4((R2), (R3), 0, 1, 0, 1);  \
+    LA_F32x4 la_t3_ = LA_SHUFFLE4((R2), (R3), 2, 3, 2, 3);  \
+    (R0) = LA_SHUFFLE4(la_t0_, la_t2_, 0, 2, 0, 2);         \
+    (R1) = LA_SHUFFLE4(la_t0_, la_t2_, 1, 3, 1, 3);         \
+    (R2) = LA_SHUFFLE4(la_t1_, la_t3_, 0, 2, 0, 2);         \
+    (R3) = LA_SHUFFLE4(la_t1_, la_t3_, 1, 3, 1, 3);         \
+} while (0)
+
+/* Select lanes of A where MASK is set, otherwise lanes of B (MASK from a vector compare). */
+#define LA_SELECTN(MASK, A, B) ((LA_F32xN)(((LA_I32xN)(A) & (MASK)) | ((LA_I32xN)(B) & ~(MASK))))
+
+/* Pack the sign bit of every lane of a compare mask into the low LA_SIMD_WIDTH bits (movmskps on x86). */
+LA_INLINE uint32_t LA_MaskBitsN(LA_I32xN mask) {
+#if (LA_SIMD == LA_SIMD_AVX2)
+    return (uint32_t)__builtin_ia32_movmskps256((LA_F32xN)mask);
+#elif (LA_SIMD == LA_SIMD_SSE2)
+    return (uint32_t)__builtin_ia32_movmskps((LA_F32xN)mask);
+#else
+    uint32_t bits = 0;
+    int32_t k;
+
+    for (k = 0; k < LA_SIMD_WIDTH; k++)
+        bits |= ((uint32_t)mask[k] >> 31) << k;
+
+    return bits;
+#endif
+}
+
+/*
+ * Square root engine accuracy levels.
+ * LA_SQRT_ESTIMATE: hardware estimate (rsqrtps, ~12 bits) or bit-trick seed + 1 Newton step (~10 bits).
+ * LA_SQRT_FAST:     one more Newton step (~22 bits on x64, ~17 bits elsewhere).
+ * LA_SQRT_PRECISE:  hardware sqrtps/sqrt.s, or a third Newton step (sqrt within 1 ULP, rsqrt within 3 ULP).
+ *
+ * The software path scales denormal inputs by 2^24 before the bit-trick seed and
+ * scales the result back, and returns inf for sqrt(inf) and 0 for rsqrt(inf), so
+ * the bounds above hold over every positive float. On x64 the ESTIMATE and FAST
+ * levels start from rsqrtps, which treats denormals as 0 and turns inf into NaN.
+ */
+#define LA_SQRT_ESTIMATE 0
+#define LA_SQRT_FAST     1
+#define LA_SQRT_PRECISE  2
+
+#define LA_RSQRT_MAGIC 0x5F375A86
+#define LA_SQRT_TINY   1.17549435e-38f /* Smallest normal float */
+#define LA_SQRT_HUGE   3.40282347e+38f /* Largest finite float */
+#define LA_SQRT_SCALE  16777216.0f     /* 2^24, lifts every denormal into the normal range */
+#define LA_SQRT_RSCALE 4096.0f         /* sqrt(LA_SQRT_SCALE), undoes the scale on a reciprocal root */
+#define LA_SQRT_SSCALE 2.44140625e-4f  /* 1 / sqrt(LA_SQRT_SCALE), undoes the scale on a root */
+
+static inline LA_F32xN LA_RSqrtNewtonN(LA_F32xN n, LA_F32xN y) {
+    return y * (1.5f - (0.5f * n * y * y));
+}
+
+/* Reciprocal square root of every lane. Lanes <= 0 are undefined. */
+static inline LA_F32xN LA_RSqrtN(LA_F32xN n, int32_t accuracy) {
+    LA_F32xN y;
+
+#if LA_SIMD_X86
+#if (LA_SIMD == LA_SIMD_AVX2)
+    if (accuracy >= LA_SQRT_PRECISE)
+        return 1.0f / __builtin_ia32_sqrtps256(n);
+    y = __builtin_ia32_rsqrtps256(n);
+#else
+    if (accuracy >= LA_SQRT_PRECISE)
+        return 1.0f / __builtin_ia32_sqrtps(n);
+    y = __builtin_ia32_rsqrtps(n);
+#endif
+    if (accuracy >= LA_SQRT_FAST)
+        y = LA_RSqrtNewtonN(n, y);
+
+    return y;
+#else
+    const LA_F32xN zero = {0.0f};
+    const LA_F32xN one = zero + 1.0f;
+    LA_I32xN tiny = (n < LA_SQRT_TINY);
+    LA_F32xN m = LA_SELECTN(tiny, n * LA_SQRT_SCALE, n);
+
+    y = LA_RSqrtNewtonN(m, (LA_F32xN)(LA_RSQRT_MAGIC - ((LA_I32xN)m >> 1)));
+    if (accuracy >= LA_SQRT_PRECISE)
+        y = LA_RSqrtNewtonN(m, y);
+    if (accuracy >= LA_SQRT_FAST)
+        y = LA_RSqrtNewtonN(m, y);
+
+    y = y * LA_SELECTN(tiny, zero + LA_SQRT_RSCALE, one);
+    return LA_SELECTN(n > LA_SQRT_HUGE, zero, y);
+#endif
+}
+
+/* Square root of every lane. Lanes <= 0 produce 0. */
+static inline LA_F32xN LA_SqrtN(LA_F32xN n, int32_t accuracy) {
+    const LA_F32xN zero = {0.0f};
+
+#if (LA_SIMD == LA_SIMD_AVX2)
+    if (accuracy >= LA_SQRT_PRECISE)
+        return LA_SELECTN(n > zero, __builtin_ia32_sqrtps256(n), zero);
+#elif (LA_SIMD == LA_SIMD_SSE2)
+    if (accuracy >= LA_SQRT_PRECISE)
+        return LA_SELECTN(n > zero, __builtin_ia32_sqrtps(n), zero);
+#endif
+#if LA_SIMD_X86
+    LA_F32xN root = n * LA_RSqrtN(n, accuracy);
+#else
+    const LA_F32xN one = zero + 1.0f;
+    LA_I32xN tiny = (n < LA_SQRT_TINY);
+    LA_F32xN m = LA_SELECTN(tiny, n * LA_SQRT_SCALE, n);
+    LA_F32xN y = LA_RSqrtN(m, accuracy);
+    LA_F32xN root = m * y;
+
+    /* One residual correction brings the software path to within 1 ULP. */
+    if (accuracy >= LA_SQRT_PRECISE)
+        root = root + (0.5f * y * (m - root * root));
+
+    root = root * LA_SELECTN(tiny, zero + LA_SQRT_SSCALE, one);
+    root = LA_SELECTN(n > LA_SQRT_HUGE, n, root);
+#endif
+    /* n * rsqrt(n) would turn 0 into 0 * inf, so those lanes are patched back to zero. */
+    return LA_SELECTN(n > zero, root, zero);
+}
+
+/*
+ * Single precision sin/cos: a four-part Cody-Waite reduction by pi/2 followed by
+ * the Cephes minimax polynomials on [-pi/4, pi/4]. The first three parts of pi/2
+ * are short enough that j * part is exact for |x| < 12868, but near multiples of
+ * pi/2 the rounding of j * LA_TRIG_PIO2_4 starts to show past 512. Lanes above
+ * LA_TRIG_REDUCE_MAX are therefore reduced by LibAxis_TrigReduceLargeF (Payne-Hanek
+ * against 224 bits of 2/pi) instead. Measured against long double: within 1.61 ULP
+ * for every float up to 2^16 and for random samples up to 2^127; inf and NaN give NaN.
+ */
+#define LA_TRIG_2_OVER_PI 0.636619772367581343f
+#define LA_TRIG_PIO2_1    1.5703125f
+#define LA_TRIG_PIO2_2    4.837512969970703125e-4f
+#define LA_TRIG_PIO2_3    7.549533620476722717e-8f
+#define LA_TRIG_PIO2_4    2.563344068257089611e-12f
+#define LA_TRIG_ROUND     12582912.0f /* 1.5 * 2^23, adding it rounds to the nearest integer */
+#define LA_TRIG_SIGN      ((int32_t)0x80000000)
+#define LA_TRIG_REDUCE_MAX 512.0f /* Largest |x| the Cody-Waite reduction handles */
+
+#define LA_SINF_C0 -1.6666654611e-1f
+#define LA_SINF_C1  8.3321608736e-3f
+#define LA_SINF_C2 -1.9515295891e-4f
+#define LA_COSF_C0  4.166664568298827e-2f
+#define LA_COSF_C1 -1.388731625493765e-3f
+#define LA_COSF_C2  2.443315711809948e-5f
+
+extern float LibAxis_TrigReduceLargeF(float x, int32_t* quadrant);
+
+/* Sine and cosine of every lane. */
+LA_INLINE void LA_SinCosN(LA_F32xN x, LA_F32xN* s, LA_F32xN* c) {
+    LA_F32xN j, r, r2, ps, pc;
+    LA_I32xN q, swap, big;
+    int32_t k, lane_q;
+
+    /* The low bits of (x * 2/pi + 1.5 * 2^23) are the quadrant, two's complement. */
+    j = (x * LA_TRIG_2_OVER_PI) + LA_TRIG_ROUND;
+    q = (LA_I32xN)j;
+    j = j - LA_TRIG_ROUND;
+
+    r = (((x - (j * LA_TRIG_PIO2_1)) - (j * LA_TRIG_PIO2_2)) - (j * LA_TRIG_PIO2_3)) - (j * LA_TRIG_PIO2_4);
+
+    /* Large lanes are rare, so they are patched one at a time with the scalar reduction. */
+    big = ((LA_F32xN)((LA_I32xN)x & 0x7FFFFFFF) > LA_TRIG_REDUCE_MAX);
+    if (LA_MaskBitsN(big)) {
+        for (k = 0; k < LA_SIMD_WIDTH; k++) {
+            if (big[k]) {
+                r[k] = LibAxis_TrigReduceLargeF(x[k], &lane_q);
+                q[k] = lane_q;
+            }
+        }
+    }
+    r2 = r * r;
+    ps = r + (r * r2 * (LA_SINF_C0 + r2 * (LA_SINF_C1 + r2 * LA_SINF_C2)));
+    pc = (1.0f - (0.5f * r2)) + (r2 * r2 * (LA_COSF_C0 + r2 * (LA_COSF_C1 + r2 * LA_COSF_C2)));
+
+    swap = ((q & 1) != 0);
+    *s = (LA_F32xN)((LA_I32xN)LA_SELECTN(swap, pc, ps) ^ (((q & 2) != 0) & LA_TRIG_SIGN));
+    *c = (LA_F32xN)((LA_I32xN)LA_SELECTN(swap, ps, pc) ^ ((((q + 1) & 2) != 0) & LA_TRIG_SIGN));
+}
+
+/*
+ * Single precision arccos from the Cephes asinf polynomial: |x| <= 0.5 uses
+ * pi/2 - asin(x), larger arguments use 2 * asin(sqrt((1 - |x|) / 2)) reflected
+ * about pi/2 for negative x. Accurate to ~2 ULP; |x| > 1 clamps to 0 or pi.
+ */
+#define LA_TRIG_PI       3.14159265358979f
+#define LA_TRIG_PIO2     1.57079632679490f
+
+#define LA_ASINF_C0 1.6666752422e-1f
+#define LA_ASINF_C1 7.4953002686e-2f
+#define LA_ASINF_C2 4.5470025998e-2f
+#define LA_ASINF_C3 2.4181311049e-2f
+#define LA_ASINF_C4 4.2163199048e-2f
+
+/* Arccosine of every lane. */
+LA_INLINE LA_F32xN LA_ACosN(LA_F32xN x) {
+    const LA_F32xN zero = {0.0f};
+    LA_F32xN a, z, s, p, r;
+    LA_I32xN big;
+
+    a = LA_SELECTN(x < zero, -x, x);
+    big = (a > 0.5f);
+    z = LA_SELECTN(big, 0.5f * (1.0f - a), x * x);
+    s = LA_SELECTN(big, LA_SqrtN(z, LA_SQRT_PRECISE), x);
+    p = s + (s * z * (LA_ASINF_C0 + z * (LA_ASINF_C1 + z * (LA_ASINF_C2 + z * (LA_ASINF_C3 + z * LA_ASINF_C4)))));
+    r = LA_SELECTN(big, p + p, LA_TRIG_PIO2 - p);
+
+    return LA_SELECTN(big & (x < zero), LA_TRIG_PI - r, r);
+}
+
+#endif /* LIBAXIS_SIMD_H */
\ No newline at end of file
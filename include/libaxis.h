@@ -2,10 +2,24 @@
 #define LIBAXIS_H
 
 #include "lainttypes.h"
+#include "lasimd.h"
 #include "friendlynames.h"
 #include "macros.h"
 #include "math/lamath.h"
 #include "color.h"
+#include "texture.h"
+#include "pose.h"
+#include "transform.h"
+#include "frustum.h"
+#include "bvh.h"
+#include "hashgrid.h"
+#include "fixed.h"
+#include "ray.h"
+#include "camera.h"
+#include "matrixstack.h"
+#include "arena.h"
+#include "jobs.h"
+#include "dispatch.h"
 
 /* ReactOS Standalone Math */
 extern double sin(double x);
@@ -20,8 +34,16 @@ extern float LibAxis_PowF(float base, int32_t exp);
 extern int32_t LibAxis_Abs(int32_t n);
 extern float LibAxis_SinF(float f);
 extern float LibAxis_CosF(float f);
+extern void LibAxis_SinCosF(float f, float* s, float* c);
+extern float LibAxis_TrigReduceLargeF(float x, int32_t* quadrant);
+extern void LibAxis_SinCosArrayF(float* s, float* c, float* in, uint32_t count);
 float LibAxis_ArcCosF(float f);
 extern float LibAxis_SqrtF(float n);
+extern float LibAxis_RSqrtF(float n);
+extern float LibAxis_SqrtLevelF(float n, int32_t accuracy);
+extern float LibAxis_RSqrtLevelF(float n, int32_t accuracy);
+extern void LibAxis_SqrtArrayF(float* out, float* in, uint32_t count, int32_t accuracy);
+extern void LibAxis_RSqrtArrayF(float* out, float* in, uint32_t count, int32_t accuracy);
 
 /* color.c */
 extern void LibAxis_Color_RGBToHSV(uint8_t r, uint8_t g, uint8_t b, float* h, float* s, float* v);
@@ -29,16 +51,73 @@ extern void LibAxis_Color_HSVToRGB(float h, float s, float v, uint8_t* r, uint8_
 extern void LibAxis_Color_CycleHue(float* hue, float speed);
 extern void LibAxis_Color_LerpCosine(float* value, float timer, float min);
 extern Color_RGBA32 LibAxis_Color_LerpRBA32Percent(uint32_t rgba1, uint32_t rgba2, float percent);
+extern void LibAxis_Color_RGBA32ToHSVArray(Color_HSVf* hsv, Color_RGBA32* rgba, uint32_t count);
+extern void LibAxis_Color_RGBA32ToHSVArrayLUT(Color_HSVf* hsv, Color_RGBA32* rgba, uint32_t count);
+extern void LibAxis_Color_HSVToRGBA32Array(Color_RGBA32* rgba, Color_HSVf* hsv, uint32_t count);
+extern void LibAxis_Color_AdjustHSVArray(Color_RGBA32* out, Color_RGBA32* in, uint32_t count, float hue, float saturation, float value);
+extern void LibAxis_Color_RGBToHSVPlanar(float* h, float* s, float* v, uint8_t* r, uint8_t* g, uint8_t* b, uint32_t count);
+extern void LibAxis_Color_HSVToRGBPlanar(uint8_t* r, uint8_t* g, uint8_t* b, float* h, float* s, float* v, uint32_t count);
+
+/* texture.c */
+extern uint32_t LibAxis_Texture_Size(int32_t format, uint32_t width, uint32_t height);
+extern int32_t LibAxis_Texture_Convert(void* dst, int32_t dst_format, void* src, int32_t src_format, uint32_t width, uint32_t height, int32_t flags);
 
 /* matrix.c */
 extern void LibAxis_Matrix44ToFixed44(Mtx44* m, float mf[4][4]);
+extern void LibAxis_Matrix44ToFixed44Array(Mtx44* m, float mf[][4][4], uint32_t count);
+extern void LibAxis_Fixed44ToMatrix44(float mf[4][4], Mtx44* m);
+extern void LibAxis_Fixed44ToMatrix44Array(float mf[][4][4], Mtx44* m, uint32_t count);
 extern void LibAxis_Matrix44_IdentityF(float mf[4][4]);
 extern void LibAxis_Matrix44_TranslateF(float mf[4][4], float x, float y, float z);
 extern void LibAxis_Matrix44_ScaleF(float mf[4][4], float x, float y, float z);
 extern void LibAxis_Matrix44_RotateF(float mf[4][4], float roll, float pitch, float heading);
+extern void LibAxis_Matrix44_PerspectiveF(float mf[4][4], float fov_y, float aspect, float near, float far);
+extern void LibAxis_Matrix44_OrthographicF(float mf[4][4], float left, float right, float bottom, float top, float near, float far);
+extern void LibAxis_Matrix44_LookAtF(float mf[4][4], Vec3f* eye, Vec3f* target, Vec3f* up);
 extern void LibAxis_Matrix44_MultiplyF(float mf_a[4][4], float mf_b[4][4], float mf[4][4]);
+extern void LibAxis_Matrix44_MultiplyArrayF(float mf_a[][4][4], float mf_b[][4][4], float mf[][4][4], uint32_t count);
+extern void LibAxis_Matrix44_PreMultiplyArrayF(float mf_a[4][4], float mf_b[][4][4], float mf[][4][4], uint32_t count);
+extern void LibAxis_Matrix44_PostMultiplyArrayF(float mf_a[][4][4], float mf_b[4][4], float mf[][4][4], uint32_t count);
+extern void LibAxis_Matrix44_TransposeF(float mf[4][4]);
+extern void LibAxis_Matrix44_TransposeArrayF(float mf[][4][4], uint32_t count);
+extern int32_t LibAxis_Matrix44_InverseF(float mf_a[4][4], float mf[4][4]);
+extern uint32_t LibAxis_Matrix44_InverseArrayF(float mf_a[][4][4], float mf[][4][4], uint32_t count);
+extern int32_t LibAxis_Matrix44_InverseAffineF(float mf_a[4][4], float mf[4][4]);
+extern uint32_t LibAxis_Matrix44_InverseAffineArrayF(float mf_a[][4][4], float mf[][4][4], uint32_t count);
+extern void LibAxis_Matrix44_InverseRigidF(float mf_a[4][4], float mf[4][4]);
+extern void LibAxis_Matrix44_InverseRigidArrayF(float mf_a[][4][4], float mf[][4][4], uint32_t count);
+extern Vec3f LibAxis_Matrix44_TransformPointF(float mf[4][4], Vec3f* point);
+extern Vec3f LibAxis_Matrix44_TransformVectorF(float mf[4][4], Vec3f* vector);
+extern Vec3f LibAxis_Matrix44_ProjectPointF(float mf[4][4], Vec3f* point);
+extern Vec4f LibAxis_Matrix44_TransformVec4F(float mf[4][4], Vec4f* vector);
+extern void LibAxis_Matrix44_TransformPointArrayF(float mf[4][4], Vec3f* out, Vec3f* in, uint32_t count);
+extern void LibAxis_Matrix44_TransformVectorArrayF(float mf[4][4], Vec3f* out, Vec3f* in, uint32_t count);
+extern void LibAxis_Matrix44_ProjectPointArrayF(float mf[4][4], Vec3f* out, Vec3f* in, uint32_t count);
+extern void LibAxis_Matrix44_TransformVec4ArrayF(float mf[4][4], Vec4f* out, Vec4f* in, uint32_t count);
+extern void LibAxis_Matrix44_TransformPointStridedF(float mf[4][4], void* out, uint32_t out_stride, void* in, uint32_t in_stride, uint32_t count);
+extern void LibAxis_Matrix44_TransformVectorStridedF(float mf[4][4], void* out, uint32_t out_stride, void* in, uint32_t in_stride, uint32_t count);
+extern void LibAxis_Matrix44_ProjectPointStridedF(float mf[4][4], void* out, uint32_t out_stride, void* in, uint32_t in_stride, uint32_t count);
+extern void LibAxis_Matrix44_TransformPointStreamF(float mf[4][4], Vec3fStream* out, Vec3fStream* in);
+extern void LibAxis_Matrix44_TransformVectorStreamF(float mf[4][4], Vec3fStream* out, Vec3fStream* in);
+extern void LibAxis_Matrix44_TransformVec4StreamF(float mf[4][4], Vec4fStream* out, Vec4fStream* in);
+extern void LibAxis_Matrix44_ProjectPointStreamF(float mf[4][4], Vec3fStream* out, Vec3fStream* in);
+extern void LibAxis_Matrix43_IdentityF(float mf[4][3]);
+extern void LibAxis_Matrix43_MultiplyF(float mf_a[4][3], float mf_b[4][3], float mf[4][3]);
+extern void LibAxis_Matrix43_MultiplyArrayF(float mf_a[][4][3], float mf_b[][4][3], float mf[][4][3], uint32_t count);
+extern void LibAxis_Matrix43_PostMultiplyArrayF(float mf_a[][4][3], float mf_b[4][3], float mf[][4][3], uint32_t count);
+extern Vec3f LibAxis_Matrix43_TransformPointF(float mf[4][3], Vec3f* point);
+extern Vec3f LibAxis_Matrix43_TransformVectorF(float mf[4][3], Vec3f* vector);
+extern void LibAxis_Matrix43_TransformPointArrayF(float mf[4][3], Vec3f* out, Vec3f* in, uint32_t count);
+extern void LibAxis_Matrix43_TransformVectorArrayF(float mf[4][3], Vec3f* out, Vec3f* in, uint32_t count);
+extern int32_t LibAxis_Matrix43_InverseF(float mf_a[4][3], float mf[4][3]);
+extern void LibAxis_Matrix43ToMatrix44F(float mf_a[4][3], float mf[4][4]);
+extern void LibAxis_Matrix44ToMatrix43F(float mf_a[4][4], float mf[4][3]);
+extern void LibAxis_Matrix43ToFixed44(Mtx44* m, float mf[4][3]);
 
 /* vector.c */
+#ifdef LIBAXIS_INLINE
+#include "math/vectorinline.h"
+#else
 extern void Vec2f_AddAssignment(Vec2f* lhs, Vec2f* rhs);
 extern void Vec2f_SubAssignment(Vec2f* lhs, Vec2f* rhs);
 extern void Vec2f_MultiplyAssignment(Vec2f* lhs, Vec2f* rhs);
@@ -286,6 +365,14 @@ extern QuatF QuatF_AddW(QuatF lhs, float rhs);
 extern QuatF QuatF_SubW(QuatF lhs, float rhs);
 extern void QuatF_ConjugateAssignment(QuatF* lhs);
 extern QuatF QuatF_Conjugate(QuatF lhs);
+extern void QuatF_MultiplyAssignment(QuatF* lhs, QuatF* rhs);
+extern QuatF QuatF_Multiply(QuatF lhs, QuatF rhs);
+extern void QuatF_RotateVec3fAssignment(Vec3f* lhs, QuatF* rhs);
+extern Vec3f QuatF_RotateVec3f(QuatF* lhs, Vec3f rhs);
+extern void QuatF_NlerpAssignment(QuatF* lhs, QuatF* rhs, float t);
+extern QuatF QuatF_Nlerp(QuatF lhs, QuatF rhs, float t);
+extern void QuatF_SlerpAssignment(QuatF* lhs, QuatF* rhs, float t);
+extern QuatF QuatF_Slerp(QuatF lhs, QuatF rhs, float t);
 extern void QuatF_AxisAngleAssignment(QuatF* lhs, Vec3f* axis, float angle);
 extern QuatF QuatF_AxisAngle(QuatF lhs, Vec3f* axis, float angle);
 extern void QuatF_FromEulerAssignment(QuatF* lhs, Vec3f* rhs);
@@ -295,5 +382,152 @@ extern Vec3f QuatF_ToAngleAxis(QuatF* lhs, Vec3f axis, float* angle);
 extern void QuatF_FromLookRotationAssignment(QuatF* lhs, Vec3f* look_at, Vec3f* up);
 extern QuatF QuatF_FromLookRotation(Vec3f* look_at, Vec3f* up);
 extern void QuatF_ToMatrixAssignment(float matrix[4][4], QuatF lhs);
+#endif /* LIBAXIS_INLINE */
+
+/* stream.c */
+extern void Vec3fStream_Init(Vec3fStream* stream, float* buffer, uint32_t count);
+extern void Vec3fStream_FromVec3f(Vec3fStream* stream, Vec3f* src);
+extern void Vec3fStream_ToVec3f(Vec3fStream* stream, Vec3f* dst);
+extern void Vec3fStream_Add(Vec3fStream* out, Vec3fStream* lhs, Vec3fStream* rhs);
+extern void Vec3fStream_Sub(Vec3fStream* out, Vec3fStream* lhs, Vec3fStream* rhs);
+extern void Vec3fStream_Multiply(Vec3fStream* out, Vec3fStream* lhs, Vec3fStream* rhs);
+extern void Vec3fStream_MultiplyF(Vec3fStream* out, Vec3fStream* lhs, float rhs);
+extern void Vec3fStream_Dot(float* out, Vec3fStream* lhs, Vec3fStream* rhs);
+extern void Vec3fStream_Cross(Vec3fStream* out, Vec3fStream* lhs, Vec3fStream* rhs);
+extern void Vec3fStream_Normalize(Vec3fStream* out, Vec3fStream* lhs);
+extern void Vec3fStream_Lerp(Vec3fStream* out, Vec3fStream* lhs, Vec3fStream* rhs, float t);
+extern void Vec4fStream_Init(Vec4fStream* stream, float* buffer, uint32_t count);
+extern void Vec4fStream_FromVec4f(Vec4fStream* stream, Vec4f* src);
+extern void Vec4fStream_ToVec4f(Vec4fStream* stream, Vec4f* dst);
+extern void Vec4fStream_Add(Vec4fStream* out, Vec4fStream* lhs, Vec4fStream* rhs);
+extern void Vec4fStream_Sub(Vec4fStream* out, Vec4fStream* lhs, Vec4fStream* rhs);
+extern void Vec4fStream_Multiply(Vec4fStream* out, Vec4fStream* lhs, Vec4fStream* rhs);
+extern void Vec4fStream_MultiplyF(Vec4fStream* out, Vec4fStream* lhs, float rhs);
+extern void Vec4fStream_Dot(float* out, Vec4fStream* lhs, Vec4fStream* rhs);
+extern void Vec4fStream_Normalize(Vec4fStream* out, Vec4fStream* lhs);
+extern void Vec4fStream_Lerp(Vec4fStream* out, Vec4fStream* lhs, Vec4fStream* rhs, float t);
+
+/* quaternion.c */
+extern void LibAxis_QuatF_MultiplyArray(QuatF* out, QuatF* lhs, QuatF* rhs, uint32_t count);
+extern void LibAxis_QuatF_NormalizeArray(QuatF* out, QuatF* in, uint32_t count);
+extern void LibAxis_QuatF_RotateVec3fArray(Vec3f* out, QuatF* quat, Vec3f* in, uint32_t count);
+extern void LibAxis_QuatF_NlerpArray(QuatF* out, QuatF* lhs, QuatF* rhs, float t, uint32_t count);
+extern void LibAxis_QuatF_SlerpArray(QuatF* out, QuatF* lhs, QuatF* rhs, float t, uint32_t count);
+
+/* pose.c */
+extern void LibAxis_Pose_Init(Pose* pose, float* buffer, uint32_t count);
+extern void LibAxis_Pose_Identity(Pose* pose);
+extern void LibAxis_Pose_Blend(Pose* out, Pose* lhs, Pose* rhs, float t);
+extern void LibAxis_Pose_BlendWeighted(Pose* out, Pose** poses, float* weights, uint32_t pose_count);
+extern void LibAxis_Pose_LocalMatrices(float mf[][4][4], Pose* pose);
+extern void LibAxis_Pose_ModelMatrices(float mf[][4][4], Pose* pose, int32_t* parents);
+extern void LibAxis_Pose_SkinningMatrices(float palette[][4][4], float model[][4][4], float inverse_bind[][4][4], uint32_t count);
+extern void LibAxis_Pose_SkinningMatricesFixed(Mtx44* palette, float model[][4][4], float inverse_bind[][4][4], uint32_t count);
+
+/* transform.c */
+extern void LibAxis_Transform_Init(TransformTree* tree, void* buffer, uint32_t capacity);
+extern int32_t LibAxis_Transform_Add(TransformTree* tree, int32_t parent, float local[4][4]);
+extern void LibAxis_Transform_SetLocal(TransformTree* tree, int32_t node, float local[4][4]);
+extern void LibAxis_Transform_MarkDirty(TransformTree* tree, int32_t node);
+extern uint32_t LibAxis_Transform_Update(TransformTree* tree);
+
+/* frustum.c */
+extern void LibAxis_Frustum_FromMatrix44F(Frustum* frustum, float mf[4][4]);
+extern int32_t LibAxis_Frustum_TestSphere(Frustum* frustum, Vec3f* center, float radius);
+extern int32_t LibAxis_Frustum_TestAABB(Frustum* frustum, Vec3f* min, Vec3f* max);
+extern uint32_t LibAxis_Frustum_CullSpheres(Frustum* frustum, uint32_t* visible, Vec3fStream* center, float* radius);
+extern uint32_t LibAxis_Frustum_CullAABBs(Frustum* frustum, uint32_t* visible, Vec3fStream* min, Vec3fStream* max);
+
+/* bvh.c */
+extern void LibAxis_Bvh_Init(Bvh* bvh, void* buffer, uint32_t capacity);
+extern uint32_t LibAxis_Bvh_BuildAABBs(Bvh* bvh, Vec3f* min, Vec3f* max, uint32_t count);
+extern uint32_t LibAxis_Bvh_BuildTriangles(Bvh* bvh, Vec3f* vertices, uint32_t count);
+extern void LibAxis_Bvh_RefitAABBs(Bvh* bvh, Vec3f* min, Vec3f* max);
+extern void LibAxis_Bvh_RefitTriangles(Bvh* bvh, Vec3f* vertices);
+extern int32_t LibAxis_Bvh_Raycast(Bvh* bvh, Vec3f* origin, Vec3f* direction, float* t);
+extern uint32_t LibAxis_Bvh_QueryAABB(Bvh* bvh, Vec3f* min, Vec3f* max, uint32_t* out, uint32_t max_out);
+extern int32_t LibAxis_Bvh_Nearest(Bvh* bvh, Vec3f* point, Vec3f* closest, float* distance_sq);
+
+/* hashgrid.c */
+extern void LibAxis_HashGrid_Init(HashGrid* grid, void* buffer, uint32_t capacity, float cell_size);
+extern uint32_t LibAxis_HashGrid_Build(HashGrid* grid, Vec3f* points, uint32_t count);
+extern uint32_t LibAxis_HashGrid_QueryRadius(HashGrid* grid, Vec3f* center, float radius, uint32_t* out, uint32_t max_out);
+extern uint32_t LibAxis_HashGrid_Pairs(HashGrid* grid, float radius, uint32_t* pairs, uint32_t max_pairs);
+
+/* fixed.c */
+extern qs1616_t LibAxis_Fixed_AddSat(qs1616_t a, qs1616_t b);
+extern qs1616_t LibAxis_Fixed_SubSat(qs1616_t a, qs1616_t b);
+extern qs1616_t LibAxis_Fixed_MulSat(qs1616_t a, qs1616_t b);
+extern qs1616_t LibAxis_Fixed_Sqrt(qs1616_t a);
+extern qs1616_t LibAxis_Fixed_RSqrt(qs1616_t a);
+extern void LibAxis_Fixed_Vec3iAddSat(Vec3i* out, Vec3i* lhs, Vec3i* rhs);
+extern void LibAxis_Fixed_Vec3iSubSat(Vec3i* out, Vec3i* lhs, Vec3i* rhs);
+extern void LibAxis_Fixed_Vec3iScaleSat(Vec3i* out, Vec3i* lhs, qs1616_t scale);
+extern qs1616_t LibAxis_Fixed_Vec3iDot(Vec3i* lhs, Vec3i* rhs);
+extern void LibAxis_Fixed_Vec3iCross(Vec3i* out, Vec3i* lhs, Vec3i* rhs);
+extern void LibAxis_Fixed_Vec3iNormalize(Vec3i* out, Vec3i* lhs);
+extern void LibAxis_Fixed_Vec3sAddSat(Vec3s* out, Vec3s* lhs, Vec3s* rhs);
+extern void LibAxis_Fixed_Vec3sSubSat(Vec3s* out, Vec3s* lhs, Vec3s* rhs);
+extern void LibAxis_Fixed_Vec3sMulSat(Vec3s* out, Vec3s* lhs, Vec3s* rhs);
+extern void LibAxis_Fixed_Vec3sScaleSat(Vec3s* out, Vec3s* lhs, qs115_t scale);
+extern qs115_t LibAxis_Fixed_Vec3sDot(Vec3s* lhs, Vec3s* rhs);
+extern void LibAxis_Fixed_Vec3sCross(Vec3s* out, Vec3s* lhs, Vec3s* rhs);
+extern void LibAxis_Fixed_Vec3sNormalize(Vec3s* out, Vec3s* lhs);
+extern void LibAxis_Fixed_Matrix44FromMatrix44F(qs1616_t mq[4][4], float mf[4][4]);
+extern void LibAxis_Fixed_Matrix44ToMatrix44F(float mf[4][4], qs1616_t mq[4][4]);
+extern void LibAxis_Fixed_Matrix44Multiply(qs1616_t mq_a[4][4], qs1616_t mq_b[4][4], qs1616_t mq[4][4]);
+extern void LibAxis_Fixed_Matrix44TransformPoint(Vec3i* out, Vec3i* v, qs1616_t mq[4][4]);
+extern void LibAxis_Fixed_Matrix44TransformPointArray(Vec3i* out, Vec3i* in, qs1616_t mq[4][4], uint32_t count);
+extern void LibAxis_Fixed_PackMatrix44(Mtx44* m, qs1616_t mq[4][4]);
+extern void LibAxis_Fixed_UnpackMatrix44(qs1616_t mq[4][4], Mtx44* m);
+
+/* ray.c */
+extern void LibAxis_Ray_InitHits(RayHitStream* hits, float* buffer, uint32_t count, float t_max);
+extern int32_t LibAxis_Ray_Triangle(RayHit* hit, Vec3f* origin, Vec3f* direction, Vec3f* v);
+extern int32_t LibAxis_Ray_AABB(RayHit* hit, Vec3f* origin, Vec3f* direction, Vec3f* min, Vec3f* max);
+extern int32_t LibAxis_Ray_Sphere(RayHit* hit, Vec3f* origin, Vec3f* direction, Vec3f* center, float radius);
+extern void LibAxis_Ray_TrianglePacket(RayHitStream* hits, Vec3fStream* origin, Vec3fStream* direction, Vec3f* v, int32_t index);
+extern void LibAxis_Ray_AABBPacket(RayHitStream* hits, Vec3fStream* origin, Vec3fStream* direction, Vec3f* min, Vec3f* max, int32_t index);
+extern void LibAxis_Ray_SpherePacket(RayHitStream* hits, Vec3fStream* origin, Vec3fStream* direction, Vec3f* center, float radius, int32_t index);
+
+/* camera.c */
+extern void LibAxis_Camera_Init(Camera* camera);
+extern void LibAxis_Camera_LookAt(Camera* camera, Vec3f* eye, Vec3f* target, Vec3f* up);
+extern void LibAxis_Camera_Perspective(Camera* camera, float fov_y, float aspect, float near, float far);
+extern void LibAxis_Camera_Orthographic(Camera* camera, float left, float right, float bottom, float top, float near, float far);
+extern uint32_t LibAxis_Camera_Update(Camera* camera);
+extern int32_t LibAxis_Camera_UpdateInverse(Camera* camera);
+extern int32_t LibAxis_Camera_Unproject(Camera* camera, Vec3f* out, Vec3f* ndc);
+extern int32_t LibAxis_Camera_PickRay(Camera* camera, Vec3f* origin, Vec3f* direction, float x, float y);
+
+/* matrixstack.c */
+extern void LibAxis_MatrixStack_Init(MatrixStack* stack, void* buffer, uint32_t capacity);
+extern int32_t LibAxis_MatrixStack_Push(MatrixStack* stack);
+extern int32_t LibAxis_MatrixStack_Pop(MatrixStack* stack);
+extern void LibAxis_MatrixStack_Identity(MatrixStack* stack);
+extern void LibAxis_MatrixStack_Load(MatrixStack* stack, float mf[4][4]);
+extern void LibAxis_MatrixStack_Multiply(MatrixStack* stack, float mf[4][4]);
+extern float (*LibAxis_MatrixStack_Top(MatrixStack* stack))[4];
+extern Mtx44* LibAxis_MatrixStack_TopFixed(MatrixStack* stack);
+
+/* arena.c */
+extern void LibAxis_Arena_Init(Arena* arena, void* buffer, uint32_t size);
+extern void* LibAxis_Arena_Alloc(Arena* arena, uint32_t size, uint32_t align);
+extern void* LibAxis_Arena_AllocShared(Arena* arena, uint32_t size, uint32_t align);
+extern uint32_t LibAxis_Arena_Mark(Arena* arena);
+extern void LibAxis_Arena_Rewind(Arena* arena, uint32_t mark);
+extern void LibAxis_Arena_Reset(Arena* arena);
+extern int32_t LibAxis_Arena_AllocVec3fStream(Arena* arena, Vec3fStream* stream, uint32_t count);
+extern int32_t LibAxis_Arena_AllocVec4fStream(Arena* arena, Vec4fStream* stream, uint32_t count);
+
+/* jobs.c */
+extern void LibAxis_Jobs_Init(JobSystem* jobs, void* buffer, uint32_t worker_count, void (*idle)(void));
+extern void LibAxis_Jobs_ParallelFor(JobSystem* jobs, JobFunc func, void* data, uint32_t count, uint32_t chunk);
+extern void LibAxis_Jobs_Worker(JobSystem* jobs, uint32_t worker);
+extern void LibAxis_Jobs_Stop(JobSystem* jobs);
+
+/* dispatch.c */
+extern uint32_t LibAxis_Cpu_Features(void);
+extern uint32_t LibAxis_Dispatch_Init(uint32_t allowed);
 
 #endif /* LIBAXIS_h */
\ No newline at end of file
@@ -28,6 +28,17 @@ typedef union Matrix44 {
     };
 } Mtx4F_t, mtx4f_t;
 
+/* Affine 4x4 with the constant (0, 0, 0, 1) column dropped: linear part in rows 0-2, translation in row 3. */
+typedef union Matrix43 {
+    float mf[4][3];
+    struct {
+        float xx, xy, xz;
+        float yx, yy, yz;
+        float zx, zy, zz;
+        float wx, wy, wz;
+    };
+} Mtx43F_t, mtx43f_t;
+
 /* Sequestered from glankk/n64/gbi.h */
 typedef int32_t Mtx44_t[4][4];
 typedef union {
@@ -91,6 +102,13 @@ static const mtx3f_t mtx3f_identity = (mtx3f_t){
     , 0.0f, 0.0f, 1.0f
 };
 
+static const mtx43f_t mtx43f_identity = (mtx43f_t){
+      1.0f, 0.0f, 0.0f
+    , 0.0f, 1.0f, 0.0f
+    , 0.0f, 0.0f, 1.0f
+    , 0.0f, 0.0f, 0.0f
+};
+
 static const mtx4f_t mtx4f_identity = (mtx4f_t){
       1.0f, 0.0f, 0.0f, 0.0f
     , 0.0f, 1.0f, 0.0f, 0.0f
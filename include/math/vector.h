@@ -39,6 +39,33 @@ typedef struct {
     float x, y, z, w;
 } Vec4f, QuatF;
 
+/*
+ * Structure-of-arrays streams. Each plane holds `count` floats and is padded to
+ * LA_STREAM_PAD(count) so the batch kernels can run whole SIMD registers
+ * without a scalar tail. Use Vec3fStream_Init/Vec4fStream_Init to carve the
+ * planes out of one LA_STREAM_ALIGN aligned buffer.
+ */
+#define LA_STREAM_ALIGN 32
+#define LA_STREAM_LANES 8
+#define LA_STREAM_PAD(COUNT) ((((uint32_t)(COUNT)) + (LA_STREAM_LANES - 1)) & ~(uint32_t)(LA_STREAM_LANES - 1))
+#define VEC3F_STREAM_FLOATS(COUNT) (LA_STREAM_PAD(COUNT) * 3)
+#define VEC4F_STREAM_FLOATS(COUNT) (LA_STREAM_PAD(COUNT) * 4)
+
+typedef struct {
+    float* x;
+    float* y;
+    float* z;
+    uint32_t count;
+} Vec3fStream;
+
+typedef struct {
+    float* x;
+    float* y;
+    float* z;
+    float* w;
+    uint32_t count;
+} Vec4fStream;
+
 #define VEC_OVERRIDE(_1, _2, _3, _4, N, ...) N
 #define VEC2F_NEW(x, y) (Vec2f){(x), (y)}
 #define VEC3F_NEW(x, y, z) (Vec3f){(x), (y), (z)}
@@ -133,6 +160,9 @@ static const Vec4s Vec4s_Backward = VECS_NEW(0, 0, -1, 0);
 static const Vec4s Vec4s_Ndentity = VECS_NEW(0, 0, 0, -1);
 static const Vec4s Vec4s_Zero     = VECS_NEW(0, 0, 0, 0);
 
+/* QuatF_Slerp falls back to a normalized lerp when the inputs' cosine exceeds this. */
+#define LA_QUAT_SLERP_LINEAR 0.9995f
+
 #define QuatF_Xhat                      Vec4f_Right
 #define QuatF_Yhat                      Vec4f_Up
 #define QuatF_Zhat                      Vec4f_Forward
@@ -143,13 +173,11 @@ static const Vec4s Vec4s_Zero     = VECS_NEW(0, 0, 0, 0);
 #define QuatF_Ndentity                  Vec4f_Ndentity
 #define QuatF_AddAssignment             Vec4f_AddAssignment
 #define QuatF_SubAssignment             Vec4f_SubAssignment
-#define QuatF_MultiplyAssignment        Vec4f_MultiplyAssignment
 #define QuatF_DivideAssignment          Vec4f_DivideAssignment
 #define QuatF_MultiplyAssignmentF       Vec4f_MultiplyAssignmentF
 #define QuatF_DivideAssignmentF         Vec4f_DivideAssignmentF
 #define QuatF_Add                       Vec4f_Add
 #define QuatF_Sub                       Vec4f_Sub
-#define QuatF_Multiply                  Vec4f_Multiply
 #define QuatF_Divide                    Vec4f_Divide
 #define QuatF_MultiplyF                 Vec4f_MultiplyF
 #define QuatF_DivideF                   Vec4f_DivideF
@@ -0,0 +1,32 @@
+#ifndef LIBAXIS_MATRIXSTACK_H
+#define LIBAXIS_MATRIXSTACK_H
+
+/*
+ * A fixed-depth matrix stack for display-list style traversal (push, load or
+ * multiply, draw, pop), in the library's row-vector convention: a vertex is
+ * transformed as v * top.
+ *
+ * Every level keeps the matrix applied at that level on its own. Load and
+ * Multiply only edit that local matrix; the concatenation with the levels
+ * below is deferred until LibAxis_MatrixStack_Top asks for it, and then only
+ * the levels changed since the last read are rebuilt. A push that is popped
+ * before the top is read, or a level that is read twice, costs no matrix
+ * multiply. LibAxis_MatrixStack_TopFixed likewise converts the top to Mtx44
+ * only when it changed since the last conversion.
+ *
+ * All arrays are carved out of one caller-owned buffer of
+ * LA_MATRIXSTACK_BYTES(capacity) bytes, ideally 16 byte aligned.
+ */
+#define LA_MATRIXSTACK_BYTES(CAPACITY) ((uint32_t)(CAPACITY) * ((sizeof(float) * 32) + sizeof(Mtx44) + sizeof(uint8_t)))
+
+typedef struct {
+    float (*local)[4][4];   /* Matrix applied at each level */
+    float (*world)[4][4];   /* Concatenated matrix of each level, valid below valid */
+    Mtx44* fixed;           /* Fixed-point form of world, when flagged */
+    uint8_t* flags;
+    uint32_t depth;         /* Index of the top level */
+    uint32_t valid;         /* Levels [0, valid) have an up to date world matrix */
+    uint32_t capacity;
+} MatrixStack;
+
+#endif /* LIBAXIS_MATRIXSTACK_H */
@@ -0,0 +1,26 @@
+#ifndef LIBAXIS_POSE_H
+#define LIBAXIS_POSE_H
+
+/*
+ * An animation pose holds one local transform per bone, as translation,
+ * rotation and scale. Each channel is its own array, so a whole channel can be
+ * blended by the batch kernels in one call. LibAxis_Pose_Init carves the
+ * three arrays out of one caller-owned buffer of LA_POSE_FLOATS(count) floats,
+ * so nothing is allocated per bone.
+ *
+ * A skeleton is a parent index per bone. Parents must come before their
+ * children (parents[i] < i), and roots use LA_POSE_ROOT. Matrices use the
+ * library's row-vector convention (v' = v * M): local = scale * rotation *
+ * translation, model = local * model[parent], and skinning = inverse_bind * model.
+ */
+#define LA_POSE_ROOT (-1)
+#define LA_POSE_FLOATS(COUNT) ((uint32_t)(COUNT) * 10)
+
+typedef struct {
+    QuatF* rotation;
+    Vec3f* translation;
+    Vec3f* scale;
+    uint32_t count;
+} Pose;
+
+#endif /* LIBAXIS_POSE_H */
\ No newline at end of file
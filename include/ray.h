@@ -0,0 +1,39 @@
+#ifndef LIBAXIS_RAY_H
+#define LIBAXIS_RAY_H
+
+/*
+ * Ray intersection tests against triangles (Moller-Trumbore), axis-aligned
+ * boxes (slabs) and spheres. Distances are in units of the ray direction,
+ * which need not be normalized. A ray starting inside a box or sphere hits
+ * it at t = 0.
+ *
+ * Every test keeps the nearest hit: it only reports a hit closer than the t
+ * already in the RayHit, so set t to the maximum distance (the segment length
+ * for a line-of-sight query) and test the primitives one after another. u and
+ * v are the barycentrics of a triangle hit, the weights of its second and
+ * third vertex; box and sphere hits set them to 0.
+ *
+ * The packet forms test a structure-of-arrays batch of rays against one
+ * primitive, LA_SIMD_WIDTH rays per iteration (4 on SSE2, 8 with AVX2; see
+ * dispatch.h). Like the stream kernels they run over the padding up to
+ * LA_STREAM_PAD(count), so the lanes past count are computed but never
+ * meaningful. RayHitStream lanes that are hit take the primitive's index.
+ */
+#define LA_RAY_MISS (-1)
+#define LA_RAY_HIT_FLOATS(COUNT) (LA_STREAM_PAD(COUNT) * 4)
+
+typedef struct {
+    float t;
+    float u;
+    float v;
+} RayHit;
+
+typedef struct {
+    float* t;
+    float* u;
+    float* v;
+    int32_t* index; /* Primitive of the nearest hit, or LA_RAY_MISS */
+    uint32_t count;
+} RayHitStream;
+
+#endif /* LIBAXIS_RAY_H */
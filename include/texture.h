@@ -0,0 +1,32 @@
+#ifndef LIBAXIS_TEXTURE_H
+#define LIBAXIS_TEXTURE_H
+
+/*
+ * Texture formats understood by LibAxis_Texture_Convert, described by their
+ * layout in memory (which is also the RDP/TMEM layout on the N64):
+ *
+ * LA_TEXFMT_RGBA32  r, g, b, a bytes (Color_RGBA32)
+ * LA_TEXFMT_RGB24   r, g, b bytes, alpha is 255 when decoded
+ * LA_TEXFMT_RGBA16  big-endian RGBA5551: rrrrrggg ggbbbbba
+ * LA_TEXFMT_IA16    intensity byte, alpha byte
+ * LA_TEXFMT_IA8     iiiiaaaa
+ * LA_TEXFMT_IA4     two texels per byte, iiia in the high nibble first
+ * LA_TEXFMT_I8      intensity byte, alpha is the intensity when decoded
+ * LA_TEXFMT_I4      two texels per byte, high nibble first
+ *
+ * Every row of a 4-bit format starts on a byte boundary.
+ */
+#define LA_TEXFMT_RGBA32 0
+#define LA_TEXFMT_RGB24  1
+#define LA_TEXFMT_RGBA16 2
+#define LA_TEXFMT_IA16   3
+#define LA_TEXFMT_IA8    4
+#define LA_TEXFMT_IA4    5
+#define LA_TEXFMT_I8     6
+#define LA_TEXFMT_I4     7
+#define LA_TEXFMT_COUNT  8
+
+/* Conversion flags. */
+#define LA_TEXTURE_DITHER 0x1 /* 4x4 ordered (Bayer) dithering when reducing channel depth */
+
+#endif /* LIBAXIS_TEXTURE_H */
\ No newline at end of file
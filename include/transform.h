@@ -0,0 +1,31 @@
+#ifndef LIBAXIS_TRANSFORM_H
+#define LIBAXIS_TRANSFORM_H
+
+/*
+ * A flat transform hierarchy. Nodes are stored in depth-first pre-order: every
+ * node is followed by its whole subtree, and subtree_end[i] is one past its last
+ * descendant. LibAxis_Transform_Add enforces this by only accepting a parent whose
+ * subtree is still open at the end of the tree (the previous node or one of its
+ * ancestors). A changed local matrix then invalidates one contiguous range of
+ * world matrices. LibAxis_Transform_Update rebuilds only those ranges. Its scan
+ * starts at the lowest dirty node, and it returns at once when nothing is dirty.
+ *
+ * All arrays are carved out of one caller-owned buffer of
+ * LA_TRANSFORM_BYTES(capacity) bytes, ideally 16 byte aligned.
+ */
+#define LA_TRANSFORM_NONE (-1)
+#define LA_TRANSFORM_BYTES(CAPACITY) ((uint32_t)(CAPACITY) * ((sizeof(float) * 32) + (sizeof(int32_t) * 2) + sizeof(uint8_t)))
+
+typedef struct {
+    float (*local)[4][4];
+    float (*world)[4][4];
+    int32_t* parent;
+    int32_t* subtree_end;
+    uint8_t* dirty;
+    uint32_t count;
+    uint32_t capacity;
+    uint32_t dirty_count;
+    uint32_t dirty_first;
+} TransformTree;
+
+#endif /* LIBAXIS_TRANSFORM_H */
\ No newline at end of file
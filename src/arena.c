@@ -0,0 +1,135 @@
+/**
+ * @file: arena.c
+ * @author: CrookedPoe (https://github.com/CrookedPoe)
+ *
+ * @brief Bump-pointer arena for aligned scratch memory.
+**/
+
+#include "../include/libaxis.h"
+
+/* Offset of the first byte at or after offset whose address is a multiple of align (a power of two). */
+LA_INLINE uint32_t Arena_AlignF(Arena* arena, uint32_t offset, uint32_t align) {
+    uintptr_t address = (uintptr_t)(arena->base + offset);
+
+    return offset + (uint32_t)((0 - address) & (uintptr_t)(align - 1));
+}
+
+/**
+* @brief Make an arena over a buffer and empty it.
+* @param arena The arena to initialize
+* @param buffer Memory to allocate from; it need not be aligned
+* @param size Size of buffer in bytes
+* @return void
+**/
+void LibAxis_Arena_Init(Arena* arena, void* buffer, uint32_t size) {
+    arena->base = (uint8_t*)buffer;
+    arena->size = size;
+    arena->offset = 0;
+    arena->peak = 0;
+}
+
+/**
+* @brief Allocate size bytes from an arena owned by the calling thread.
+* @param arena The arena
+* @param size Number of bytes
+* @param align Alignment in bytes, a power of two (LA_ARENA_ALIGN, LA_STREAM_ALIGN, 64)
+* @return void* The memory, or NULL if the arena is full
+**/
+void* LibAxis_Arena_Alloc(Arena* arena, uint32_t size, uint32_t align) {
+    uint32_t start = Arena_AlignF(arena, arena->offset, align);
+
+    if (start > arena->size || size > arena->size - start)
+        return NULL;
+
+    arena->offset = start + size;
+    if (arena->offset > arena->peak)
+        arena->peak = arena->offset;
+
+    return arena->base + start;
+}
+
+/**
+* @brief Allocate size bytes from an arena that other threads allocate from at the same time.
+* @param arena The arena
+* @param size Number of bytes
+* @param align Alignment in bytes, a power of two
+* @return void* The memory, or NULL if the arena is full
+**/
+void* LibAxis_Arena_AllocShared(Arena* arena, uint32_t size, uint32_t align) {
+    uint32_t offset = __atomic_load_n(&arena->offset, __ATOMIC_RELAXED);
+    uint32_t start;
+
+    do {
+        start = Arena_AlignF(arena, offset, align);
+        if (start > arena->size || size > arena->size - start)
+            return NULL;
+    } while (!__atomic_compare_exchange_n(&arena->offset, &offset, start + size, 1, __ATOMIC_RELAXED, __ATOMIC_RELAXED));
+
+    return arena->base + start;
+}
+
+/**
+* @brief Remember how much of the arena is in use, to rewind to later.
+* @param arena The arena
+* @return uint32_t The mark
+**/
+uint32_t LibAxis_Arena_Mark(Arena* arena) {
+    return arena->offset;
+}
+
+/**
+* @brief Free everything allocated since a mark was taken.
+* @param arena The arena
+* @param mark A mark from LibAxis_Arena_Mark, no newer than the last rewind
+* @return void
+**/
+void LibAxis_Arena_Rewind(Arena* arena, uint32_t mark) {
+    if (arena->offset > arena->peak)
+        arena->peak = arena->offset;
+
+    if (mark < arena->offset)
+        arena->offset = mark;
+}
+
+/**
+* @brief Free everything in the arena.
+* @param arena The arena
+* @return void
+**/
+void LibAxis_Arena_Reset(Arena* arena) {
+    LibAxis_Arena_Rewind(arena, 0);
+}
+
+/**
+* @brief Allocate the planes of a Vec3fStream of count elements, LA_STREAM_ALIGN aligned.
+* @param arena The arena
+* @param stream The stream to point at the new planes
+* @param count Number of elements
+* @return int32_t 1 on success, 0 if the arena is full
+**/
+int32_t LibAxis_Arena_AllocVec3fStream(Arena* arena, Vec3fStream* stream, uint32_t count) {
+    float* buffer = (float*)LibAxis_Arena_Alloc(arena, VEC3F_STREAM_FLOATS(count) * sizeof(float), LA_STREAM_ALIGN);
+
+    if (buffer == NULL)
+        return 0;
+
+    Vec3fStream_Init(stream, buffer, count);
+    return 1;
+}
+
+/**
+* @brief Allocate the planes of a Vec4fStream of count elements, LA_STREAM_ALIGN aligned.
+* @param arena The arena
+* @param stream The stream to point at the new planes
+* @param count Number of elements
+* @return int32_t 1 on success, 0 if the arena is full
+**/
+int32_t LibAxis_Arena_AllocVec4fStream(Arena* arena, Vec4fStream* stream, uint32_t count) {
+    float* buffer = (float*)LibAxis_Arena_Alloc(arena, VEC4F_STREAM_FLOATS(count) * sizeof(float), LA_STREAM_ALIGN);
+
+    if (buffer == NULL)
+        return 0;
+
+    Vec4fStream_Init(stream, buffer, count);
+    return 1;
+}
@@ -0,0 +1,660 @@
+/**
+ * @file: bvh.c
+ * @author: CrookedPoe (https://github.com/CrookedPoe)
+ *
+ * @brief Bounding volume hierarchy build, refit and queries.
+**/
+
+#include "../include/libaxis.h"
+
+#define BVH_STACK (LA_BVH_MAX_DEPTH + 2)
+#define BVH_EPSILON 1e-12f
+
+/* Box, centroid box and primitive count of a bin, or of one side of a split. */
+typedef struct {
+    Vec3f min;
+    Vec3f max;
+    Vec3f cmin;
+    Vec3f cmax;
+    uint32_t count;
+} BvhBin;
+
+/* A node waiting to be split, with the centroid box of its primitives. */
+typedef struct {
+    uint32_t node;
+    int32_t depth;
+    Vec3f cmin;
+    Vec3f cmax;
+} BvhTask;
+
+LA_INLINE Vec3f Bvh_SubF(Vec3f* a, Vec3f* b) {
+    return VEC3F_NEW(a->x - b->x, a->y - b->y, a->z - b->z);
+}
+
+LA_INLINE float Bvh_DotF(Vec3f* a, Vec3f* b) {
+    return (a->x * b->x) + (a->y * b->y) + (a->z * b->z);
+}
+
+LA_INLINE Vec3f Bvh_CrossF(Vec3f* a, Vec3f* b) {
+    return VEC3F_NEW((a->y * b->z) - (a->z * b->y), (a->z * b->x) - (a->x * b->z), (a->x * b->y) - (a->y * b->x));
+}
+
+/* a + b * s */
+LA_INLINE Vec3f Bvh_MadF(Vec3f* a, Vec3f* b, float s) {
+    return VEC3F_NEW(a->x + (b->x * s), a->y + (b->y * s), a->z + (b->z * s));
+}
+
+LA_INLINE void Bvh_EmptyF(Vec3f* min, Vec3f* max) {
+    *min = VEC3F_NEW(3.4e38f, 3.4e38f, 3.4e38f);
+    *max = VEC3F_NEW(-3.4e38f, -3.4e38f, -3.4e38f);
+}
+
+LA_INLINE void Bvh_GrowF(Vec3f* min, Vec3f* max, Vec3f* lo, Vec3f* hi) {
+    min->x = LA_MIN2(min->x, lo->x);
+    min->y = LA_MIN2(min->y, lo->y);
+    min->z = LA_MIN2(min->z, lo->z);
+    max->x = LA_MAX2(max->x, hi->x);
+    max->y = LA_MAX2(max->y, hi->y);
+    max->z = LA_MAX2(max->z, hi->z);
+}
+
+/* Half the surface area of a box, which is all the SAH needs. */
+LA_INLINE float Bvh_AreaF(Vec3f* min, Vec3f* max) {
+    float x = max->x - min->x;
+    float y = max->y - min->y;
+    float z = max->z - min->z;
+
+    return (x * y) + (y * z) + (z * x);
+}
+
+LA_INLINE float Bvh_AxisF(Vec3f* v, int32_t axis) {
+    return (axis == 0) ? v->x : ((axis == 1) ? v->y : v->z);
+}
+
+/* Squared distance from p to a box, 0 inside it. */
+LA_INLINE float Bvh_BoxDistanceF(Vec3f* min, Vec3f* max, Vec3f* p) {
+    float x = LA_MAX3(min->x - p->x, 0.0f, p->x - max->x);
+    float y = LA_MAX3(min->y - p->y, 0.0f, p->y - max->y);
+    float z = LA_MAX3(min->z - p->z, 0.0f, p->z - max->z);
+
+    return (x * x) + (y * y) + (z * z);
+}
+
+/* Slab test: entry distance of the ray into a box, or a value >= t_max on a miss. */
+LA_INLINE float Bvh_RayBoxF(Vec3f* min, Vec3f* max, Vec3f* origin, Vec3f* inverse, float t_max) {
+    float x0 = (min->x - origin->x) * inverse->x;
+    float x1 = (max->x - origin->x) * inverse->x;
+    float y0 = (min->y - origin->y) * inverse->y;
+    float y1 = (max->y - origin->y) * inverse->y;
+    float z0 = (min->z - origin->z) * inverse->z;
+    float z1 = (max->z - origin->z) * inverse->z;
+    float t_near = LA_MAX3(LA_MIN2(x0, x1), LA_MIN2(y0, y1), LA_MIN2(z0, z1));
+    float t_far = LA_MIN3(LA_MAX2(x0, x1), LA_MAX2(y0, y1), LA_MAX2(z0, z1));
+
+    t_near = LA_MAX2(t_near, 0.0f);
+    return (t_near <= t_far) ? t_near : t_max;
+}
+
+/* Moller-Trumbore: distance along the ray to triangle v, or a value >= t_max on a miss. */
+static float Bvh_RayTriangleF(Vec3f* v, Vec3f* origin, Vec3f* direction, float t_max) {
+    Vec3f e1 = Bvh_SubF(&v[1], &v[0]);
+    Vec3f e2 = Bvh_SubF(&v[2], &v[0]);
+    Vec3f p = Bvh_CrossF(direction, &e2);
+    Vec3f s, q;
+    float det = Bvh_DotF(&e1, &p);
+    float u, w, t;
+
+    if (LA_ABS(det) < BVH_EPSILON)
+        return t_max;
+
+    det = 1.0f / det;
+    s = Bvh_SubF(origin, &v[0]);
+    u = Bvh_DotF(&s, &p) * det;
+    if (u < 0.0f || u > 1.0f)
+        return t_max;
+
+    q = Bvh_CrossF(&s, &e1);
+    w = Bvh_DotF(direction, &q) * det;
+    if (w < 0.0f || (u + w) > 1.0f)
+        return t_max;
+
+    t = Bvh_DotF(&e2, &q) * det;
+    return (t >= 0.0f) ? t : t_max;
+}
+
+/* Closest point to p on triangle v, by Voronoi region (Ericson, Real-Time Collision Detection 5.1.5). */
+static Vec3f Bvh_ClosestOnTriangleF(Vec3f* v, Vec3f* p) {
+    Vec3f ab = Bvh_SubF(&v[1], &v[0]);
+    Vec3f ac = Bvh_SubF(&v[2], &v[0]);
+    Vec3f ap = Bvh_SubF(p, &v[0]);
+    Vec3f bp, cp, bc, r;
+    float d1, d2, d3, d4, d5, d6, va, vb, vc, denom;
+
+    d1 = Bvh_DotF(&ab, &ap);
+    d2 = Bvh_DotF(&ac, &ap);
+    if (d1 <= 0.0f && d2 <= 0.0f)
+        return v[0];
+
+    bp = Bvh_SubF(p, &v[1]);
+    d3 = Bvh_DotF(&ab, &bp);
+    d4 = Bvh_DotF(&ac, &bp);
+    if (d3 >= 0.0f && d4 <= d3)
+        return v[1];
+
+    vc = (d1 * d4) - (d3 * d2);
+    if (vc <= 0.0f && d1 >= 0.0f && d3 <= 0.0f)
+        return Bvh_MadF(&v[0], &ab, d1 / (d1 - d3));
+
+    cp = Bvh_SubF(p, &v[2]);
+    d5 = Bvh_DotF(&ab, &cp);
+    d6 = Bvh_DotF(&ac, &cp);
+    if (d6 >= 0.0f && d5 <= d6)
+        return v[2];
+
+    vb = (d5 * d2) - (d1 * d6);
+    if (vb <= 0.0f && d2 >= 0.0f && d6 <= 0.0f)
+        return Bvh_MadF(&v[0], &ac, d2 / (d2 - d6));
+
+    va = (d3 * d6) - (d5 * d4);
+    if (va <= 0.0f && (d4 - d3) >= 0.0f && (d5 - d6) >= 0.0f) {
+        bc = Bvh_SubF(&v[2], &v[1]);
+        return Bvh_MadF(&v[1], &bc, (d4 - d3) / ((d4 - d3) + (d5 - d6)));
+    }
+
+    denom = 1.0f / (va + vb + vc);
+    r = Bvh_MadF(&v[0], &ab, vb * denom);
+    return Bvh_MadF(&r, &ac, vc * denom);
+}
+
+/* Fill bvh->bounds from boxes or from triangles. */
+static void Bvh_BoundsF(Bvh* bvh, Vec3f* min, Vec3f* max, Vec3f* vertices, uint32_t count) {
+    Vec3f* v;
+    uint32_t i;
+
+    for (i = 0; i < count; i++) {
+        if (vertices == NULL) {
+            bvh->bounds[i * 2] = min[i];
+            bvh->bounds[(i * 2) + 1] = max[i];
+            continue;
+        }
+
+        v = &vertices[i * 3];
+        bvh->bounds[i * 2] = VEC3F_NEW(LA_MIN3(v[0].x, v[1].x, v[2].x), LA_MIN3(v[0].y, v[1].y, v[2].y), LA_MIN3(v[0].z, v[1].z, v[2].z));
+        bvh->bounds[(i * 2) + 1] = VEC3F_NEW(LA_MAX3(v[0].x, v[1].x, v[2].x), LA_MAX3(v[0].y, v[1].y, v[2].y), LA_MAX3(v[0].z, v[1].z, v[2].z));
+    }
+}
+
+/* Doubled centroid of a primitive, which saves the halving everywhere it is used. */
+LA_INLINE Vec3f Bvh_CentroidF(Bvh* bvh, uint32_t prim) {
+    Vec3f* b = &bvh->bounds[prim * 2];
+
+    return VEC3F_NEW(b[0].x + b[1].x, b[0].y + b[1].y, b[0].z + b[1].z);
+}
+
+/* Box and centroid box of index[first .. first + count). */
+static void Bvh_RangeBoundsF(Bvh* bvh, uint32_t first, uint32_t count, BvhBin* out) {
+    Vec3f c;
+    uint32_t i;
+
+    Bvh_EmptyF(&out->min, &out->max);
+    Bvh_EmptyF(&out->cmin, &out->cmax);
+    out->count = count;
+    for (i = first; i < first + count; i++) {
+        c = Bvh_CentroidF(bvh, bvh->index[i]);
+        Bvh_GrowF(&out->min, &out->max, &bvh->bounds[bvh->index[i] * 2], &bvh->bounds[(bvh->index[i] * 2) + 1]);
+        Bvh_GrowF(&out->cmin, &out->cmax, &c, &c);
+    }
+}
+
+/* Bin of a primitive along axis; the binning and the partition must agree exactly. */
+LA_INLINE int32_t Bvh_BinF(Bvh* bvh, uint32_t prim, int32_t axis, float lo, float scale) {
+    Vec3f c = Bvh_CentroidF(bvh, prim);
+    int32_t bin = (int32_t)((Bvh_AxisF(&c, axis) - lo) * scale);
+
+    return LA_CLAMP(bin, 0, LA_BVH_BINS - 1);
+}
+
+/*
+ * Split a node with a binned SAH and partition its primitives. Returns the number that go left, or 0 to
+ * keep it as a leaf. The boxes of both sides come out of the bins, so the children need no extra pass.
+ */
+static uint32_t Bvh_SplitF(Bvh* bvh, BvhTask* task, BvhBin side[2]) {
+    BvhNode* node = &bvh->nodes[task->node];
+    BvhBin bins[LA_BVH_BINS];
+    float right_area[LA_BVH_BINS];
+    uint32_t right_count[LA_BVH_BINS];
+    Vec3f c;
+    float lo, extent, scale, cost, best_cost;
+    uint32_t i, j, prim, tmp, left_count;
+    int32_t axis, b, k, best;
+
+    if (node->count <= 1 || task->depth >= LA_BVH_MAX_DEPTH)
+        return 0;
+
+    extent = LA_MAX3(task->cmax.x - task->cmin.x, task->cmax.y - task->cmin.y, task->cmax.z - task->cmin.z);
+    if (extent <= 0.0f) {
+        /* Every centroid is the same point, so only an arbitrary split can shrink the leaf. */
+        if (node->count <= LA_BVH_LEAF_MAX)
+            return 0;
+
+        Bvh_RangeBoundsF(bvh, node->first, node->count / 2, &side[0]);
+        Bvh_RangeBoundsF(bvh, node->first + (node->count / 2), node->count - (node->count / 2), &side[1]);
+        return node->count / 2;
+    }
+
+    axis = (extent == task->cmax.x - task->cmin.x) ? 0 : ((extent == task->cmax.y - task->cmin.y) ? 1 : 2);
+    lo = Bvh_AxisF(&task->cmin, axis);
+    scale = (float)LA_BVH_BINS / extent;
+    for (b = 0; b < LA_BVH_BINS; b++) {
+        Bvh_EmptyF(&bins[b].min, &bins[b].max);
+        Bvh_EmptyF(&bins[b].cmin, &bins[b].cmax);
+        bins[b].count = 0;
+    }
+
+    for (i = node->first; i < node->first + node->count; i++) {
+        prim = bvh->index[i];
+        c = Bvh_CentroidF(bvh, prim);
+        b = LA_CLAMP((int32_t)((Bvh_AxisF(&c, axis) - lo) * scale), 0, LA_BVH_BINS - 1);
+        bins[b].count++;
+        Bvh_GrowF(&bins[b].min, &bins[b].max, &bvh->bounds[prim * 2], &bvh->bounds[(prim * 2) + 1]);
+        Bvh_GrowF(&bins[b].cmin, &bins[b].cmax, &c, &c);
+    }
+
+    /* Price the LA_BVH_BINS - 1 planes: right areas and counts in one sweep, the left side in a second. */
+    Bvh_EmptyF(&side[1].min, &side[1].max);
+    right_count[LA_BVH_BINS - 1] = 0;
+    for (b = LA_BVH_BINS - 1; b > 0; b--) {
+        Bvh_GrowF(&side[1].min, &side[1].max, &bins[b].min, &bins[b].max);
+        right_area[b] = Bvh_AreaF(&side[1].min, &side[1].max);
+        right_count[b - 1] = right_count[b] + bins[b].count;
+    }
+
+    best = -1;
+    best_cost = 3.4e38f;
+    Bvh_EmptyF(&side[0].min, &side[0].max);
+    left_count = 0;
+    for (b = 0; b < LA_BVH_BINS - 1; b++) {
+        Bvh_GrowF(&side[0].min, &side[0].max, &bins[b].min, &bins[b].max);
+        left_count += bins[b].count;
+        if (left_count == 0 || right_count[b] == 0)
+            continue;
+
+        cost = (Bvh_AreaF(&side[0].min, &side[0].max) * (float)left_count) + (right_area[b + 1] * (float)right_count[b]);
+        if (cost < best_cost) {
+            best_cost = cost;
+            best = b;
+        }
+    }
+
+    /* One traversal step is charged as one primitive test: small nodes split only if 1 + cost / area < count. */
+    if (best < 0 || (node->count <= LA_BVH_LEAF_MAX && best_cost >= Bvh_AreaF(&node->min, &node->max) * (float)(node->count - 1)))
+        return 0;
+
+    /* Gather the boxes of the two sides of the winning plane for the children. */
+    for (k = 0; k < 2; k++) {
+        Bvh_EmptyF(&side[k].min, &side[k].max);
+        Bvh_EmptyF(&side[k].cmin, &side[k].cmax);
+        side[k].count = 0;
+    }
+    for (b = 0; b < LA_BVH_BINS; b++) {
+        k = (b > best) ? 1 : 0;
+        side[k].count += bins[b].count;
+        Bvh_GrowF(&side[k].min, &side[k].max, &bins[b].min, &bins[b].max);
+        Bvh_GrowF(&side[k].cmin, &side[k].cmax, &bins[b].cmin, &bins[b].cmax);
+    }
+
+    i = node->first;
+    j = node->first + node->count;
+    while (i < j) {
+        if (Bvh_BinF(bvh, bvh->index[i], axis, lo, scale) <= best) {
+            i++;
+        }
+        else {
+            j--;
+            tmp = bvh->index[i];
+            bvh->index[i] = bvh->index[j];
+            bvh->index[j] = tmp;
+        }
+    }
+
+    return side[0].count;
+}
+
+static void Bvh_BuildF(Bvh* bvh, uint32_t count) {
+    BvhTask stack[BVH_STACK];
+    BvhBin side[2];
+    int32_t top, k;
+    uint32_t i, left;
+    BvhNode* n;
+    BvhNode* child;
+
+    bvh->count = count;
+    bvh->node_count = 2;
+    for (i = 0; i < count; i++)
+        bvh->index[i] = i;
+
+    Bvh_RangeBoundsF(bvh, 0, count, &side[0]);
+    bvh->nodes[0].min = side[0].min;
+    bvh->nodes[0].max = side[0].max;
+    bvh->nodes[0].first = 0;
+    bvh->nodes[0].count = count;
+    bvh->nodes[1].first = 0;
+    bvh->nodes[1].count = 0;
+    Bvh_EmptyF(&bvh->nodes[1].min, &bvh->nodes[1].max);
+
+    stack[0].node = 0;
+    stack[0].depth = 0;
+    stack[0].cmin = side[0].cmin;
+    stack[0].cmax = side[0].cmax;
+    top = 1;
+    while (top > 0) {
+        top--;
+        n = &bvh->nodes[stack[top].node];
+        left = Bvh_SplitF(bvh, &stack[top], side);
+        if (left == 0)
+            continue;
+
+        /* The children take the next pair of nodes; the node itself becomes interior. */
+        child = &bvh->nodes[bvh->node_count];
+        for (k = 0; k < 2; k++) {
+            child[k].min = side[k].min;
+            child[k].max = side[k].max;
+            child[k].first = k ? (n->first + left) : n->first;
+            child[k].count = side[k].count;
+
+            stack[top + k].node = bvh->node_count + k;
+            stack[top + k].cmin = side[k].cmin;
+            stack[top + k].cmax = side[k].cmax;
+        }
+
+        stack[top + 1].depth = ++stack[top].depth;
+        n->first = bvh->node_count;
+        n->count = 0;
+        top += 2;
+        bvh->node_count += 2;
+    }
+}
+
+/* Recompute every node box from the primitive boxes, children before parents. */
+static void Bvh_RefitF(Bvh* bvh) {
+    BvhNode* n;
+    BvhNode* c;
+    uint32_t i, p;
+
+    for (i = bvh->node_count; i-- > 0;) {
+        if (i == 1)
+            continue;
+
+        n = &bvh->nodes[i];
+        if (n->count == 0) {
+            c = &bvh->nodes[n->first];
+            n->min = c[0].min;
+            n->max = c[0].max;
+            Bvh_GrowF(&n->min, &n->max, &c[1].min, &c[1].max);
+            continue;
+        }
+
+        Bvh_EmptyF(&n->min, &n->max);
+        for (p = n->first; p < n->first + n->count; p++)
+            Bvh_GrowF(&n->min, &n->max, &bvh->bounds[bvh->index[p] * 2], &bvh->bounds[(bvh->index[p] * 2) + 1]);
+    }
+}
+
+/**
+* @brief Point the arrays of a Bvh into a single buffer and empty it.
+* @param bvh The hierarchy to initialize
+* @param buffer At least LA_BVH_BYTES(capacity) bytes, ideally 64 byte aligned
+* @param capacity Maximum number of primitives
+* @return void
+**/
+void LibAxis_Bvh_Init(Bvh* bvh, void* buffer, uint32_t capacity) {
+    uint8_t* bytes = (uint8_t*)buffer;
+
+    bvh->nodes = (BvhNode*)bytes;
+    bvh->bounds = (Vec3f*)(bytes + (capacity * sizeof(BvhNode) * 2));
+    bvh->index = (uint32_t*)(bvh->bounds + (capacity * 2));
+    bvh->triangles = NULL;
+    bvh->node_count = 0;
+    bvh->count = 0;
+    bvh->capacity = capacity;
+}
+
+/**
+* @brief Build a hierarchy over axis-aligned boxes.
+* @param bvh Initialized hierarchy
+* @param min Minimum corner of every box
+* @param max Maximum corner of every box
+* @param count Number of boxes, at most bvh->capacity
+* @return uint32_t Number of nodes used, or 0 if count is 0 or too large
+**/
+uint32_t LibAxis_Bvh_BuildAABBs(Bvh* bvh, Vec3f* min, Vec3f* max, uint32_t count) {
+    if (count == 0 || count > bvh->capacity)
+        return 0;
+
+    bvh->triangles = NULL;
+    Bvh_BoundsF(bvh, min, max, NULL, count);
+    Bvh_BuildF(bvh, count);
+    return bvh->node_count;
+}
+
+/**
+* @brief Build a hierarchy over triangles. The vertices are referenced, not copied, and must outlive the hierarchy.
+* @param bvh Initialized hierarchy
+* @param vertices Three vertices per triangle
+* @param count Number of triangles, at most bvh->capacity
+* @return uint32_t Number of nodes used, or 0 if count is 0 or too large
+**/
+uint32_t LibAxis_Bvh_BuildTriangles(Bvh* bvh, Vec3f* vertices, uint32_t count) {
+    if (count == 0 || count > bvh->capacity)
+        return 0;
+
+    bvh->triangles = vertices;
+    Bvh_BoundsF(bvh, NULL, NULL, vertices, count);
+    Bvh_BuildF(bvh, count);
+    return bvh->node_count;
+}
+
+/**
+* @brief Update the node boxes of a box hierarchy after its boxes moved. The tree shape is kept.
+* @param bvh Built hierarchy
+* @param min Minimum corner of every box, same count as the build
+* @param max Maximum corner of every box
+* @return void
+**/
+void LibAxis_Bvh_RefitAABBs(Bvh* bvh, Vec3f* min, Vec3f* max) {
+    Bvh_BoundsF(bvh, min, max, NULL, bvh->count);
+    Bvh_RefitF(bvh);
+}
+
+/**
+* @brief Update the node boxes of a triangle hierarchy after its vertices moved, e.g. an animated mesh.
+* The tree shape is kept, so queries slow down if the mesh deforms far from its built pose.
+* @param bvh Built hierarchy
+* @param vertices Three vertices per triangle, same count as the build
+* @return void
+**/
+void LibAxis_Bvh_RefitTriangles(Bvh* bvh, Vec3f* vertices) {
+    bvh->triangles = vertices;
+    Bvh_BoundsF(bvh, NULL, NULL, vertices, bvh->count);
+    Bvh_RefitF(bvh);
+}
+
+/**
+* @brief Find the first primitive hit by a ray. Box hierarchies report the entry point into the box.
+* @param bvh Built hierarchy
+* @param origin Ray origin
+* @param direction Ray direction, need not be normalized
+* @param t In: maximum distance, in units of direction. Out: distance to the hit, if any
+* @return int32_t Index of the primitive hit, or LA_BVH_NONE
+**/
+int32_t LibAxis_Bvh_Raycast(Bvh* bvh, Vec3f* origin, Vec3f* direction, float* t) {
+    uint32_t stack[BVH_STACK];
+    float entry[BVH_STACK];
+    Vec3f inverse = VEC3F_NEW(1.0f / direction->x, 1.0f / direction->y, 1.0f / direction->z);
+    float best = *t;
+    float d, t0, t1;
+    int32_t top, hit = LA_BVH_NONE;
+    uint32_t i, prim, near, far;
+    BvhNode* n;
+
+    if (bvh->node_count == 0)
+        return LA_BVH_NONE;
+
+    stack[0] = 0;
+    entry[0] = Bvh_RayBoxF(&bvh->nodes[0].min, &bvh->nodes[0].max, origin, &inverse, best);
+    top = 1;
+    while (top > 0) {
+        top--;
+        if (entry[top] >= best)
+            continue;
+
+        n = &bvh->nodes[stack[top]];
+        if (n->count == 0) {
+            /* Visit the nearer child first; the other is re-checked against the best hit when popped. */
+            t0 = Bvh_RayBoxF(&bvh->nodes[n->first].min, &bvh->nodes[n->first].max, origin, &inverse, best);
+            t1 = Bvh_RayBoxF(&bvh->nodes[n->first + 1].min, &bvh->nodes[n->first + 1].max, origin, &inverse, best);
+            near = (t1 < t0) ? 1 : 0;
+            far = near ^ 1;
+
+            stack[top] = n->first + far;
+            entry[top] = far ? t1 : t0;
+            stack[top + 1] = n->first + near;
+            entry[top + 1] = near ? t1 : t0;
+            top += 2;
+            continue;
+        }
+
+        for (i = n->first; i < n->first + n->count; i++) {
+            prim = bvh->index[i];
+            if (bvh->triangles != NULL)
+                d = Bvh_RayTriangleF(&bvh->triangles[prim * 3], origin, direction, best);
+            else
+                d = Bvh_RayBoxF(&bvh->bounds[prim * 2], &bvh->bounds[(prim * 2) + 1], origin, &inverse, best);
+
+            if (d < best) {
+                best = d;
+                hit = (int32_t)prim;
+            }
+        }
+    }
+
+    *t = best;
+    return hit;
+}
+
+/**
+* @brief Collect the primitives whose boxes overlap a box.
+* @param bvh Built hierarchy
+* @param min Minimum corner of the query box
+* @param max Maximum corner of the query box
+* @param out Output primitive indices
+* @param max_out Capacity of out; the query stops once it is full
+* @return uint32_t Number of indices written
+**/
+uint32_t LibAxis_Bvh_QueryAABB(Bvh* bvh, Vec3f* min, Vec3f* max, uint32_t* out, uint32_t max_out) {
+    uint32_t stack[BVH_STACK];
+    int32_t top;
+    uint32_t i, prim, written = 0;
+    BvhNode* n;
+    Vec3f* b;
+
+    if (bvh->node_count == 0)
+        return 0;
+
+    stack[0] = 0;
+    top = 1;
+    while (top > 0) {
+        n = &bvh->nodes[stack[--top]];
+        if (n->min.x > max->x || n->max.x < min->x || n->min.y > max->y || n->max.y < min->y || n->min.z > max->z || n->max.z < min->z)
+            continue;
+
+        if (n->count == 0) {
+            stack[top] = n->first + 1;
+            stack[top + 1] = n->first;
+            top += 2;
+            continue;
+        }
+
+        for (i = n->first; i < n->first + n->count; i++) {
+            prim = bvh->index[i];
+            b = &bvh->bounds[prim * 2];
+            if (b[0].x > max->x || b[1].x < min->x || b[0].y > max->y || b[1].y < min->y || b[0].z > max->z || b[1].z < min->z)
+                continue;
+
+            if (written == max_out)
+                return written;
+            out[written++] = prim;
+        }
+    }
+
+    return written;
+}
+
+/**
+* @brief Find the primitive closest to a point. Box hierarchies measure the distance to the box.
+* @param bvh Built hierarchy
+* @param point Query point
+* @param closest Output closest point on the primitive found, if any
+* @param distance_sq In: maximum squared distance. Out: squared distance to closest, if found
+* @return int32_t Index of the closest primitive, or LA_BVH_NONE
+**/
+int32_t LibAxis_Bvh_Nearest(Bvh* bvh, Vec3f* point, Vec3f* closest, float* distance_sq) {
+    uint32_t stack[BVH_STACK];
+    float bound[BVH_STACK];
+    float best = *distance_sq;
+    float d, d0, d1;
+    int32_t top, hit = LA_BVH_NONE;
+    uint32_t i, prim, near, far;
+    BvhNode* n;
+    Vec3f* b;
+    Vec3f c, delta;
+
+    if (bvh->node_count == 0)
+        return LA_BVH_NONE;
+
+    stack[0] = 0;
+    bound[0] = Bvh_BoxDistanceF(&bvh->nodes[0].min, &bvh->nodes[0].max, point);
+    top = 1;
+    while (top > 0) {
+        top--;
+        if (bound[top] >= best)
+            continue;
+
+        n = &bvh->nodes[stack[top]];
+        if (n->count == 0) {
+            d0 = Bvh_BoxDistanceF(&bvh->nodes[n->first].min, &bvh->nodes[n->first].max, point);
+            d1 = Bvh_BoxDistanceF(&bvh->nodes[n->first + 1].min, &bvh->nodes[n->first + 1].max, point);
+            near = (d1 < d0) ? 1 : 0;
+            far = near ^ 1;
+
+            stack[top] = n->first + far;
+            bound[top] = far ? d1 : d0;
+            stack[top + 1] = n->first + near;
+            bound[top + 1] = near ? d1 : d0;
+            top += 2;
+            continue;
+        }
+
+        for (i = n->first; i < n->first + n->count; i++) {
+            prim = bvh->index[i];
+            if (bvh->triangles != NULL) {
+                c = Bvh_ClosestOnTriangleF(&bvh->triangles[prim * 3], point);
+            }
+            else {
+                b = &bvh->bounds[prim * 2];
+                c = VEC3F_NEW(LA_CLAMP(point->x, b[0].x, b[1].x), LA_CLAMP(point->y, b[0].y, b[1].y), LA_CLAMP(point->z, b[0].z, b[1].z));
+            }
+
+            delta = Bvh_SubF(&c, point);
+            d = Bvh_DotF(&delta, &delta);
+            if (d < best) {
+                best = d;
+                hit = (int32_t)prim;
+                *closest = c;
+            }
+        }
+    }
+
+    *distance_sq = best;
+    return hit;
+}
\ No newline at end of file
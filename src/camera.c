@@ -0,0 +1,182 @@
+/**
+ * @file: camera.c
+ * @author: CrookedPoe (https://github.com/CrookedPoe)
+ *
+ * @brief Camera view, projection and view-projection matrices with lazy rebuilds.
+**/
+
+#include "../include/libaxis.h"
+
+LA_INLINE int32_t Camera_SameVec3fF(Vec3f* a, Vec3f* b) {
+    return (a->x == b->x) && (a->y == b->y) && (a->z == b->z);
+}
+
+/* Store count lens parameters and mode, and mark the projection dirty if any of them changed. */
+static void Camera_SetLensF(Camera* camera, int32_t mode, float* lens, int32_t count) {
+    int32_t i, same = (camera->mode == mode);
+
+    for (i = 0; i < count; i++) {
+        same &= (camera->lens[i] == lens[i]);
+        camera->lens[i] = lens[i];
+    }
+
+    camera->mode = mode;
+    if (!same)
+        camera->dirty |= LA_CAMERA_DIRTY_PROJECTION;
+}
+
+/**
+* @brief Initialize a camera at the origin looking down -z, with a 60 degree perspective.
+* @param camera The camera to initialize
+* @return void
+**/
+void LibAxis_Camera_Init(Camera* camera) {
+    camera->eye = VEC3F_NEW(0.0f, 0.0f, 0.0f);
+    camera->target = VEC3F_NEW(0.0f, 0.0f, -1.0f);
+    camera->up = VEC3F_NEW(0.0f, 1.0f, 0.0f);
+    camera->lens[0] = 60.0f;
+    camera->lens[1] = 1.0f;
+    camera->lens[2] = 0.1f;
+    camera->lens[3] = 1000.0f;
+    camera->lens[4] = camera->lens[5] = 0.0f;
+    camera->mode = LA_CAMERA_PERSPECTIVE;
+    camera->dirty = LA_CAMERA_DIRTY_VIEW | LA_CAMERA_DIRTY_PROJECTION | LA_CAMERA_DIRTY_INVERSE;
+
+    LibAxis_Camera_Update(camera);
+}
+
+/**
+* @brief Place the camera at eye, looking at target. See LibAxis_Matrix44_LookAtF.
+* @param camera The camera
+* @param eye Position of the eye
+* @param target Point to look at
+* @param up Approximate up direction
+* @return void
+**/
+void LibAxis_Camera_LookAt(Camera* camera, Vec3f* eye, Vec3f* target, Vec3f* up) {
+    if (Camera_SameVec3fF(&camera->eye, eye) && Camera_SameVec3fF(&camera->target, target) && Camera_SameVec3fF(&camera->up, up))
+        return;
+
+    camera->eye = *eye;
+    camera->target = *target;
+    camera->up = *up;
+    camera->dirty |= LA_CAMERA_DIRTY_VIEW;
+}
+
+/**
+* @brief Give the camera a perspective projection. See LibAxis_Matrix44_PerspectiveF.
+* @param camera The camera
+* @param fov_y Vertical field of view in degrees
+* @param aspect Width over height of the viewport
+* @param near Distance to the near plane
+* @param far Distance to the far plane
+* @return void
+**/
+void LibAxis_Camera_Perspective(Camera* camera, float fov_y, float aspect, float near, float far) {
+    float lens[4] = {fov_y, aspect, near, far};
+
+    Camera_SetLensF(camera, LA_CAMERA_PERSPECTIVE, lens, 4);
+}
+
+/**
+* @brief Give the camera an orthographic projection. See LibAxis_Matrix44_OrthographicF.
+* @param camera The camera
+* @param left Left edge of the view volume
+* @param right Right edge of the view volume
+* @param bottom Bottom edge of the view volume
+* @param top Top edge of the view volume
+* @param near Distance to the near plane
+* @param far Distance to the far plane
+* @return void
+**/
+void LibAxis_Camera_Orthographic(Camera* camera, float left, float right, float bottom, float top, float near, float far) {
+    float lens[6] = {left, right, bottom, top, near, far};
+
+    Camera_SetLensF(camera, LA_CAMERA_ORTHOGRAPHIC, lens, 6);
+}
+
+/**
+* @brief Rebuild the view, projection, view-projection and frustum if their parameters changed.
+* @param camera The camera
+* @return uint32_t The LA_CAMERA_DIRTY_VIEW and LA_CAMERA_DIRTY_PROJECTION flags that were rebuilt, 0 if nothing changed
+**/
+uint32_t LibAxis_Camera_Update(Camera* camera) {
+    uint32_t rebuilt = camera->dirty & (LA_CAMERA_DIRTY_VIEW | LA_CAMERA_DIRTY_PROJECTION);
+    float* l = camera->lens;
+
+    if (rebuilt == 0)
+        return 0;
+
+    if (rebuilt & LA_CAMERA_DIRTY_VIEW)
+        LibAxis_Matrix44_LookAtF(camera->view, &camera->eye, &camera->target, &camera->up);
+
+    if (rebuilt & LA_CAMERA_DIRTY_PROJECTION) {
+        if (camera->mode == LA_CAMERA_ORTHOGRAPHIC)
+            LibAxis_Matrix44_OrthographicF(camera->projection, l[0], l[1], l[2], l[3], l[4], l[5]);
+        else
+            LibAxis_Matrix44_PerspectiveF(camera->projection, l[0], l[1], l[2], l[3]);
+    }
+
+    LibAxis_Matrix44_MultiplyF(camera->view, camera->projection, camera->view_projection);
+    LibAxis_Frustum_FromMatrix44F(&camera->frustum, camera->view_projection);
+
+    camera->dirty = LA_CAMERA_DIRTY_INVERSE;
+    return rebuilt;
+}
+
+/**
+* @brief Bring camera->inverse up to date, rebuilding the other matrices first if needed.
+* @param camera The camera
+* @return int32_t 1 if camera->inverse is valid, 0 if the view-projection is singular
+**/
+int32_t LibAxis_Camera_UpdateInverse(Camera* camera) {
+    LibAxis_Camera_Update(camera);
+
+    if (camera->dirty & LA_CAMERA_DIRTY_INVERSE) {
+        if (!LibAxis_Matrix44_InverseF(camera->view_projection, camera->inverse))
+            return 0;
+
+        camera->dirty &= ~LA_CAMERA_DIRTY_INVERSE;
+    }
+
+    return 1;
+}
+
+/**
+* @brief Map a point in normalized device coordinates back to world space.
+* @param camera The camera
+* @param out The world space point
+* @param ndc x and y in [-1, 1] across the viewport, z from -1 (near plane) to 1 (far plane)
+* @return int32_t 1 on success, 0 if the view-projection is singular
+**/
+int32_t LibAxis_Camera_Unproject(Camera* camera, Vec3f* out, Vec3f* ndc) {
+    if (!LibAxis_Camera_UpdateInverse(camera))
+        return 0;
+
+    *out = LibAxis_Matrix44_ProjectPointF(camera->inverse, ndc);
+    return 1;
+}
+
+/**
+* @brief Build the world space ray through a viewport position, from the near plane to the far plane.
+* The direction is not normalized: t = 1 along it (see ray.h) is the far plane.
+* @param camera The camera
+* @param origin The point on the near plane
+* @param direction From origin to the point on the far plane
+* @param x Horizontal position in [-1, 1], left to right
+* @param y Vertical position in [-1, 1], bottom to top
+* @return int32_t 1 on success, 0 if the view-projection is singular
+**/
+int32_t LibAxis_Camera_PickRay(Camera* camera, Vec3f* origin, Vec3f* direction, float x, float y) {
+    Vec3f ndc = VEC3F_NEW(x, y, -1.0f);
+    Vec3f end;
+
+    if (!LibAxis_Camera_UpdateInverse(camera))
+        return 0;
+
+    *origin = LibAxis_Matrix44_ProjectPointF(camera->inverse, &ndc);
+    ndc.z = 1.0f;
+    end = LibAxis_Matrix44_ProjectPointF(camera->inverse, &ndc);
+    *direction = Vec3f_Sub(end, *origin);
+    return 1;
+}
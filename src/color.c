@@ -7,7 +7,7 @@
 
 #include "../include/libaxis.h"
 
-
+#ifndef LA_DISPATCH_VARIANT
 /**
 * @brief Convert RGB color space to HSV. This is primarily based off of the math found on RapidTables.
 * @param r Red Channel (0 - 255)
@@ -22,9 +22,10 @@ void LibAxis_Color_RGBToHSV(uint8_t r, uint8_t g, uint8_t b, float* h, float* s,
     float _r, _g, _b;
     float cmax, cmin, delta;
 
-    _r = (r / 255.0f);
-    _g = (g / 255.0f);
-    _b = (b / 255.0f);
+    /* Work on the 0 - 255 values; the 1/255 scale cancels out of hue and saturation. */
+    _r = r;
+    _g = g;
+    _b = b;
 
     cmax = LibAxis_MaxF3(_r, _g, _b);
     cmin = LibAxis_MinF3(_r, _g, _b);
@@ -38,18 +39,18 @@ void LibAxis_Color_RGBToHSV(uint8_t r, uint8_t g, uint8_t b, float* h, float* s,
         *s = (delta / cmax);
 
         if (cmax == _r) {
-            *h = (60 * fmodf(((_g - _b)), 6));
+            *h = ((60.0f * (_g - _b)) / delta);
         } else if (cmax == _g) {
-            *h = (60 * (((_b - _r) / delta) + 2));
+            *h = ((60.0f * (_b - _r)) / delta) + 120.0f;
         } else {
-            *h = (60 * (((_r - _g) / delta) + 4));
+            *h = ((60.0f * (_r - _g)) / delta) + 240.0f;
         }
     }
 
     if (*h < 0.0f)
         *h += 360.0f;
     
-    *v = cmax;
+    *v = (cmax / 255.0f);
 }
 
 /**
@@ -87,7 +88,7 @@ void LibAxis_Color_HSVToRGB(float h, float s, float v, uint8_t* r, uint8_t* g, u
         rgb[0] = 0.0f; rgb[1] = x; rgb[2] = c;
     } else if (LA_RANGE_HIE(h, 240, 300)) {
         rgb[0] = x; rgb[1] = 0.0f; rgb[2] = c;
-    } else if (LA_RANGE_HIE(h, 300, 360)) {
+    } else {
         rgb[0] = c; rgb[1] = 0.0f; rgb[2] = x;
     }
 
@@ -146,4 +147,365 @@ Color_RGBA32 LibAxis_Color_LerpRBA32Percent(uint32_t rgba1, uint32_t rgba2, floa
     return_value.a = 255;
 
     return return_value;
-}
\ No newline at end of file
+}
+#endif
+
+/*
+ * Bulk conversion. The kernels below evaluate the same arithmetic as
+ * LibAxis_Color_RGBToHSV and LibAxis_Color_HSVToRGB on LA_SIMD_WIDTH pixels
+ * at a time, with the branches replaced by lane selects, so the bulk and
+ * single pixel functions agree exactly. Only this section is compiled again
+ * for AVX2 by dispatch_avx2.c.
+ */
+
+/* Round every lane towards negative infinity. */
+LA_INLINE LA_F32xN Color_FloorN(LA_F32xN x) {
+    LA_F32xN t = __builtin_convertvector(__builtin_convertvector(x, LA_I32xN), LA_F32xN);
+
+    return LA_SELECTN(t > x, t - 1.0f, t);
+}
+
+LA_INLINE void Color_RGBToHSVN(LA_F32xN r, LA_F32xN g, LA_F32xN b, LA_F32xN* h, LA_F32xN* s, LA_F32xN* v) {
+    const LA_F32xN zero = {0.0f};
+    const LA_F32xN one = zero + 1.0f;
+    LA_F32xN cmax, cmin, delta, num, off, hue;
+    LA_I32xN is_r, is_g;
+
+    cmax = LA_SELECTN(g > b, g, b);
+    cmax = LA_SELECTN(r > cmax, r, cmax);
+    cmin = LA_SELECTN(g < b, g, b);
+    cmin = LA_SELECTN(r < cmin, r, cmin);
+    delta = (cmax - cmin);
+
+    is_r = (cmax == r);
+    is_g = (cmax == g) & ~is_r;
+    num = LA_SELECTN(is_r, g - b, LA_SELECTN(is_g, b - r, r - g));
+    off = LA_SELECTN(is_r, zero, LA_SELECTN(is_g, zero + 120.0f, zero + 240.0f));
+
+    /* A grey pixel has delta == 0 and num == 0, so dividing by 1 instead yields hue 0. */
+    hue = ((60.0f * num) / LA_SELECTN(delta > zero, delta, one)) + off;
+    *h = LA_SELECTN(hue < zero, hue + 360.0f, hue);
+    *s = (delta / LA_SELECTN(cmax > zero, cmax, one));
+    *v = (cmax / 255.0f);
+}
+
+LA_INLINE void Color_HSVToRGBN(LA_F32xN h, LA_F32xN s, LA_F32xN v, LA_I32xN* r, LA_I32xN* g, LA_I32xN* b) {
+    const LA_F32xN zero = {0.0f};
+    const LA_F32xN one = zero + 1.0f;
+    LA_F32xN c, x, m, hh, f, cr, cg, cb;
+    LA_I32xN sector;
+
+    h = LA_SELECTN(h < zero, zero, LA_SELECTN(h > 360.0f, zero + 360.0f, h));
+    s = LA_SELECTN(s < zero, zero, LA_SELECTN(s > one, one, s));
+    v = LA_SELECTN(v < zero, zero, LA_SELECTN(v > one, one, v));
+
+    c = (v * s);
+    hh = (h / 60.0f);
+    f = (hh - (2.0f * Color_FloorN(hh * 0.5f))) - 1.0f;
+    x = c * (1.0f - LA_SELECTN(f < zero, -f, f));
+    m = (v - c);
+
+    /* Sector 6 (h == 360) is the same as sector 0. */
+    sector = __builtin_convertvector(hh, LA_I32xN);
+    sector = sector - ((sector > 5) & 6);
+
+    cr = LA_SELECTN((sector == 0) | (sector == 5), c, LA_SELECTN((sector == 1) | (sector == 4), x, zero));
+    cg = LA_SELECTN((sector == 1) | (sector == 2), c, LA_SELECTN((sector == 0) | (sector == 3), x, zero));
+    cb = LA_SELECTN((sector == 3) | (sector == 4), c, LA_SELECTN((sector == 2) | (sector == 5), x, zero));
+
+    *r = __builtin_convertvector((cr + m) * 255.0f, LA_I32xN);
+    *g = __builtin_convertvector((cg + m) * 255.0f, LA_I32xN);
+    *b = __builtin_convertvector((cb + m) * 255.0f, LA_I32xN);
+}
+
+LA_INLINE LA_F32xN Color_ChannelN(LA_I32xN rgba, int32_t shift) {
+    return __builtin_convertvector((rgba >> shift) & 0xFF, LA_F32xN);
+}
+
+static inline void Color_RGBA32ToHSVBlock(Color_HSVf* hsv, Color_RGBA32* rgba) {
+    LA_I32xN px = LA_LOADNI(rgba);
+    LA_F32xN h, s, v;
+    int32_t lane;
+
+    Color_RGBToHSVN(Color_ChannelN(px, LA_RGBA32_SHIFT_R), Color_ChannelN(px, LA_RGBA32_SHIFT_G),
+                    Color_ChannelN(px, LA_RGBA32_SHIFT_B), &h, &s, &v);
+
+    for (lane = 0; lane < LA_SIMD_WIDTH; lane++) {
+        hsv[lane].h = h[lane];
+        hsv[lane].s = s[lane];
+        hsv[lane].v = v[lane];
+    }
+}
+
+LA_INLINE LA_I32xN Color_PackRGBN(LA_I32xN alpha, LA_I32xN r, LA_I32xN g, LA_I32xN b) {
+    return (alpha & LA_RGBA32_ALPHA) | (r << LA_RGBA32_SHIFT_R) | (g << LA_RGBA32_SHIFT_G) | (b << LA_RGBA32_SHIFT_B);
+}
+
+static inline void Color_HSVToRGBA32Block(Color_RGBA32* rgba, Color_HSVf* hsv) {
+    LA_F32xN h, s, v;
+    LA_I32xN r, g, b;
+    int32_t lane;
+
+    for (lane = 0; lane < LA_SIMD_WIDTH; lane++) {
+        h[lane] = hsv[lane].h;
+        s[lane] = hsv[lane].s;
+        v[lane] = hsv[lane].v;
+    }
+
+    Color_HSVToRGBN(h, s, v, &r, &g, &b);
+    LA_STORENI(rgba, Color_PackRGBN(LA_LOADNI(rgba), r, g, b));
+}
+
+static inline void Color_AdjustHSVBlock(Color_RGBA32* out, Color_RGBA32* in, float hue, float saturation, float value) {
+    LA_I32xN px = LA_LOADNI(in);
+    LA_F32xN h, s, v;
+    LA_I32xN r, g, b;
+
+    Color_RGBToHSVN(Color_ChannelN(px, LA_RGBA32_SHIFT_R), Color_ChannelN(px, LA_RGBA32_SHIFT_G),
+                    Color_ChannelN(px, LA_RGBA32_SHIFT_B), &h, &s, &v);
+
+    h = h + hue;
+    h = h - (360.0f * Color_FloorN(h * (1.0f / 360.0f)));
+    Color_HSVToRGBN(h, s * saturation, v * value, &r, &g, &b);
+    LA_STORENI(out, Color_PackRGBN(px, r, g, b));
+}
+
+static inline void Color_RGBToHSVPlanarBlock(float* h, float* s, float* v, uint8_t* r, uint8_t* g, uint8_t* b) {
+    LA_F32xN fr, fg, fb, fh, fs, fv;
+    int32_t lane;
+
+    for (lane = 0; lane < LA_SIMD_WIDTH; lane++) {
+        fr[lane] = r[lane];
+        fg[lane] = g[lane];
+        fb[lane] = b[lane];
+    }
+
+    Color_RGBToHSVN(fr, fg, fb, &fh, &fs, &fv);
+    LA_STOREN(h, fh);
+    LA_STOREN(s, fs);
+    LA_STOREN(v, fv);
+}
+
+static inline void Color_HSVToRGBPlanarBlock(uint8_t* r, uint8_t* g, uint8_t* b, float* h, float* s, float* v) {
+    LA_I32xN ir, ig, ib;
+    int32_t lane;
+
+    Color_HSVToRGBN(LA_LOADN(h), LA_LOADN(s), LA_LOADN(v), &ir, &ig, &ib);
+
+    for (lane = 0; lane < LA_SIMD_WIDTH; lane++) {
+        r[lane] = ir[lane];
+        g[lane] = ig[lane];
+        b[lane] = ib[lane];
+    }
+}
+
+/**
+* @brief Convert an array of RGBA32 pixels to HSV. Alpha is ignored.
+* Results match LibAxis_Color_RGBToHSV exactly.
+* @param hsv Array of output colors (hue 0 - 360, saturation and value 0 - 1)
+* @param rgba Array of pixels
+* @param count Number of pixels
+* @return void
+**/
+void LA_KERNEL(LibAxis_Color_RGBA32ToHSVArray)(Color_HSVf* hsv, Color_RGBA32* rgba, uint32_t count) {
+    Color_RGBA32 tail_rgba[LA_SIMD_WIDTH] = {0};
+    Color_HSVf tail_hsv[LA_SIMD_WIDTH];
+    uint32_t i, j;
+
+    for (i = 0; (i + LA_SIMD_WIDTH) <= count; i += LA_SIMD_WIDTH)
+        Color_RGBA32ToHSVBlock(&hsv[i], &rgba[i]);
+
+    if (i < count) {
+        for (j = 0; (i + j) < count; j++)
+            tail_rgba[j] = rgba[i + j];
+
+        Color_RGBA32ToHSVBlock(tail_hsv, tail_rgba);
+
+        for (j = 0; (i + j) < count; j++)
+            hsv[i + j] = tail_hsv[j];
+    }
+}
+
+/**
+* @brief Convert an array of HSV colors to RGBA32 pixels, keeping the alpha already in rgba.
+* Results match LibAxis_Color_HSVToRGB exactly.
+* @param rgba Array of output pixels; only the color channels are written
+* @param hsv Array of colors (hue 0 - 360, saturation and value 0 - 1)
+* @param count Number of pixels
+* @return void
+**/
+void LA_KERNEL(LibAxis_Color_HSVToRGBA32Array)(Color_RGBA32* rgba, Color_HSVf* hsv, uint32_t count) {
+    Color_RGBA32 tail_rgba[LA_SIMD_WIDTH];
+    Color_HSVf tail_hsv[LA_SIMD_WIDTH] = {0};
+    uint32_t i, j;
+
+    for (i = 0; (i + LA_SIMD_WIDTH) <= count; i += LA_SIMD_WIDTH)
+        Color_HSVToRGBA32Block(&rgba[i], &hsv[i]);
+
+    if (i < count) {
+        for (j = 0; (i + j) < count; j++) {
+            tail_rgba[j] = rgba[i + j];
+            tail_hsv[j] = hsv[i + j];
+        }
+
+        Color_HSVToRGBA32Block(tail_rgba, tail_hsv);
+
+        for (j = 0; (i + j) < count; j++)
+            rgba[i + j] = tail_rgba[j];
+    }
+}
+
+/**
+* @brief Recolor an array of RGBA32 pixels in HSV space in a single pass, keeping alpha.
+* Each pixel is converted with LibAxis_Color_RGBToHSV, its hue is rotated and
+* wrapped to 0 - 360, saturation and value are scaled, and the result is converted
+* back with LibAxis_Color_HSVToRGB.
+* @param out Array of output pixels (may alias in)
+* @param in Array of input pixels
+* @param count Number of pixels
+* @param hue Degrees to add to the hue
+* @param saturation Saturation multiplier
+* @param value Value multiplier
+* @return void
+**/
+void LA_KERNEL(LibAxis_Color_AdjustHSVArray)(Color_RGBA32* out, Color_RGBA32* in, uint32_t count, float hue, float saturation, float value) {
+    Color_RGBA32 tail[LA_SIMD_WIDTH] = {0};
+    uint32_t i, j;
+
+    for (i = 0; (i + LA_SIMD_WIDTH) <= count; i += LA_SIMD_WIDTH)
+        Color_AdjustHSVBlock(&out[i], &in[i], hue, saturation, value);
+
+    if (i < count) {
+        for (j = 0; (i + j) < count; j++)
+            tail[j] = in[i + j];
+
+        Color_AdjustHSVBlock(tail, tail, hue, saturation, value);
+
+        for (j = 0; (i + j) < count; j++)
+            out[i + j] = tail[j];
+    }
+}
+
+/**
+* @brief Convert planar RGB channels to planar HSV. Results match LibAxis_Color_RGBToHSV exactly.
+* @param h Output hue plane (0 - 360)
+* @param s Output saturation plane (0 - 1)
+* @param v Output value plane (0 - 1)
+* @param r Red plane (0 - 255)
+* @param g Green plane (0 - 255)
+* @param b Blue plane (0 - 255)
+* @param count Number of pixels in each plane
+* @return void
+**/
+void LA_KERNEL(LibAxis_Color_RGBToHSVPlanar)(float* h, float* s, float* v, uint8_t* r, uint8_t* g, uint8_t* b, uint32_t count) {
+    uint8_t tail_rgb[3][LA_SIMD_WIDTH] = {0};
+    float tail_hsv[3][LA_SIMD_WIDTH];
+    uint32_t i, j;
+
+    for (i = 0; (i + LA_SIMD_WIDTH) <= count; i += LA_SIMD_WIDTH)
+        Color_RGBToHSVPlanarBlock(&h[i], &s[i], &v[i], &r[i], &g[i], &b[i]);
+
+    if (i < count) {
+        for (j = 0; (i + j) < count; j++) {
+            tail_rgb[0][j] = r[i + j];
+            tail_rgb[1][j] = g[i + j];
+            tail_rgb[2][j] = b[i + j];
+        }
+
+        Color_RGBToHSVPlanarBlock(tail_hsv[0], tail_hsv[1], tail_hsv[2], tail_rgb[0], tail_rgb[1], tail_rgb[2]);
+
+        for (j = 0; (i + j) < count; j++) {
+            h[i + j] = tail_hsv[0][j];
+            s[i + j] = tail_hsv[1][j];
+            v[i + j] = tail_hsv[2][j];
+        }
+    }
+}
+
+/**
+* @brief Convert planar HSV channels to planar RGB. Results match LibAxis_Color_HSVToRGB exactly.
+* @param r Output red plane (0 - 255)
+* @param g Output green plane (0 - 255)
+* @param b Output blue plane (0 - 255)
+* @param h Hue plane (0 - 360)
+* @param s Saturation plane (0 - 1)
+* @param v Value plane (0 - 1)
+* @param count Number of pixels in each plane
+* @return void
+**/
+void LA_KERNEL(LibAxis_Color_HSVToRGBPlanar)(uint8_t* r, uint8_t* g, uint8_t* b, float* h, float* s, float* v, uint32_t count) {
+    float tail_hsv[3][LA_SIMD_WIDTH] = {0};
+    uint8_t tail_rgb[3][LA_SIMD_WIDTH];
+    uint32_t i, j;
+
+    for (i = 0; (i + LA_SIMD_WIDTH) <= count; i += LA_SIMD_WIDTH)
+        Color_HSVToRGBPlanarBlock(&r[i], &g[i], &b[i], &h[i], &s[i], &v[i]);
+
+    if (i < count) {
+        for (j = 0; (i + j) < count; j++) {
+            tail_hsv[0][j] = h[i + j];
+            tail_hsv[1][j] = s[i + j];
+            tail_hsv[2][j] = v[i + j];
+        }
+
+        Color_HSVToRGBPlanarBlock(tail_rgb[0], tail_rgb[1], tail_rgb[2], tail_hsv[0], tail_hsv[1], tail_hsv[2]);
+
+        for (j = 0; (i + j) < count; j++) {
+            r[i + j] = tail_rgb[0][j];
+            g[i + j] = tail_rgb[1][j];
+            b[i + j] = tail_rgb[2][j];
+        }
+    }
+}
+
+#ifndef LA_DISPATCH_VARIANT
+/*
+ * 8-bit lookup tables for the division-free RGB to HSV path, built at compile
+ * time: 1 / n for saturation, 60 / n for hue and n / 255 for value.
+ */
+#define COLOR_TABLE4(F, N)   F(N), F((N) + 1), F((N) + 2), F((N) + 3)
+#define COLOR_TABLE16(F, N)  COLOR_TABLE4(F, N), COLOR_TABLE4(F, (N) + 4), COLOR_TABLE4(F, (N) + 8), COLOR_TABLE4(F, (N) + 12)
+#define COLOR_TABLE64(F, N)  COLOR_TABLE16(F, N), COLOR_TABLE16(F, (N) + 16), COLOR_TABLE16(F, (N) + 32), COLOR_TABLE16(F, (N) + 48)
+#define COLOR_TABLE256(F)    COLOR_TABLE64(F, 0), COLOR_TABLE64(F, 64), COLOR_TABLE64(F, 128), COLOR_TABLE64(F, 192)
+
+#define COLOR_RECIPROCAL(N)  ((N) ? (1.0f / (N)) : 0.0f)
+#define COLOR_HUE_SCALE(N)   ((N) ? (60.0f / (N)) : 0.0f)
+#define COLOR_UNIT(N)        ((N) / 255.0f)
+
+static const float Color_Reciprocal8[256] = { COLOR_TABLE256(COLOR_RECIPROCAL) };
+static const float Color_HueScale8[256] = { COLOR_TABLE256(COLOR_HUE_SCALE) };
+static const float Color_Unit8[256] = { COLOR_TABLE256(COLOR_UNIT) };
+
+/**
+* @brief Convert an array of RGBA32 pixels to HSV through 8-bit lookup tables instead
+* of divisions. Alpha is ignored. Value matches LibAxis_Color_RGBToHSV exactly; hue
+* and saturation may differ from it in the last bit. This is the faster path on
+* targets without SIMD or with slow division, such as the VR4300.
+* @param hsv Array of output colors (hue 0 - 360, saturation and value 0 - 1)
+* @param rgba Array of pixels
+* @param count Number of pixels
+* @return void
+**/
+void LibAxis_Color_RGBA32ToHSVArrayLUT(Color_HSVf* hsv, Color_RGBA32* rgba, uint32_t count) {
+    int32_t r, g, b, cmax, cmin, delta, num;
+    float h, off;
+    uint32_t i;
+
+    for (i = 0; i < count; i++) {
+        r = rgba[i].r;
+        g = rgba[i].g;
+        b = rgba[i].b;
+        cmax = LA_MAX3(r, g, b);
+        cmin = LA_MIN3(r, g, b);
+        delta = (cmax - cmin);
+
+        num = (cmax == r) ? (g - b) : (cmax == g) ? (b - r) : (r - g);
+        off = (cmax == r) ? 0.0f : (cmax == g) ? 120.0f : 240.0f;
+        h = (num * Color_HueScale8[delta]) + off;
+
+        hsv[i].h = (h < 0.0f) ? (h + 360.0f) : h;
+        hsv[i].s = (delta * Color_Reciprocal8[cmax]);
+        hsv[i].v = Color_Unit8[cmax];
+    }
+}
+#endif
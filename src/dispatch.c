@@ -0,0 +1,123 @@
+/**
+ * @file: dispatch.c
+ * @author: CrookedPoe (https://github.com/CrookedPoe)
+ *
+ * @brief CPU feature detection and runtime selection of the batch kernels.
+**/
+
+#include "../include/libaxis.h"
+
+#if LA_DISPATCH
+static uint32_t dispatch_features;
+static int32_t dispatch_detected;
+
+#define DISPATCH_DECLARE(NAME, PARAMS, ARGS) extern void NAME##_Base PARAMS; extern void NAME##_AVX2 PARAMS;
+#define DISPATCH_FIELD(NAME, PARAMS, ARGS)   void (*NAME) PARAMS;
+#define DISPATCH_BASE(NAME, PARAMS, ARGS)    NAME##_Base,
+#define DISPATCH_AVX2(NAME, PARAMS, ARGS)    NAME##_AVX2,
+#define DISPATCH_STUB(NAME, PARAMS, ARGS)    void NAME PARAMS { dispatch_table.NAME ARGS; }
+
+LA_DISPATCH_KERNELS(DISPATCH_DECLARE)
+
+typedef struct {
+    LA_DISPATCH_KERNELS(DISPATCH_FIELD)
+} DispatchTable;
+
+static const DispatchTable dispatch_base = { LA_DISPATCH_KERNELS(DISPATCH_BASE) };
+static const DispatchTable dispatch_avx2 = { LA_DISPATCH_KERNELS(DISPATCH_AVX2) };
+
+/* Usable before LibAxis_Dispatch_Init has run; the base kernels work on every host the library was built for. */
+static DispatchTable dispatch_table = { LA_DISPATCH_KERNELS(DISPATCH_BASE) };
+
+/* The public entry points. */
+LA_DISPATCH_KERNELS(DISPATCH_STUB)
+
+static void Dispatch_CpuidF(uint32_t leaf, uint32_t r[4]) {
+    __asm__ volatile("cpuid" : "=a"(r[0]), "=b"(r[1]), "=c"(r[2]), "=d"(r[3]) : "a"(leaf), "c"(0));
+}
+
+/* Register state the OS saves on a context switch (XCR0). */
+static uint32_t Dispatch_XStateF(void) {
+    uint32_t lo, hi;
+
+    __asm__ volatile("xgetbv" : "=a"(lo), "=d"(hi) : "c"(0));
+    return lo;
+}
+
+static uint32_t Dispatch_DetectF(void) {
+    uint32_t r[4], max_leaf, xstate = 0, features = 0;
+
+    Dispatch_CpuidF(0, r);
+    max_leaf = r[0];
+    if (max_leaf < 1)
+        return 0;
+
+    Dispatch_CpuidF(1, r);
+    if (r[3] & (1u << 26))
+        features |= LA_CPU_SSE2;
+    if (r[2] & (1u << 19))
+        features |= LA_CPU_SSE41;
+
+    /* AVX needs the OS to save the upper halves of the registers as well as the CPU to have them. */
+    if ((r[2] & (1u << 27)) != 0)
+        xstate = Dispatch_XStateF();
+    if ((r[2] & (1u << 28)) && ((xstate & 0x06) == 0x06)) {
+        features |= LA_CPU_AVX;
+        if (r[2] & (1u << 12))
+            features |= LA_CPU_FMA;
+
+        if (max_leaf >= 7) {
+            Dispatch_CpuidF(7, r);
+            if (r[1] & (1u << 5))
+                features |= LA_CPU_AVX2;
+            /* AVX-512 also needs the opmask and the upper 16 zmm registers saved. */
+            if ((r[1] & (1u << 16)) && ((xstate & 0xE0) == 0xE0))
+                features |= LA_CPU_AVX512F;
+        }
+    }
+
+    return features;
+}
+
+/* Bind the best kernels as soon as a hosted program loads the library. */
+__attribute__((constructor)) static void Dispatch_StartupF(void) {
+    LibAxis_Dispatch_Init(LA_CPU_ALL);
+}
+#endif
+
+/**
+* @brief Return the instruction set extensions of the host, detected with cpuid on first use.
+* @return uint32_t LA_CPU_* flags, or 0 on targets without runtime dispatch
+**/
+uint32_t LibAxis_Cpu_Features(void) {
+#if LA_DISPATCH
+    if (!dispatch_detected) {
+        dispatch_features = Dispatch_DetectF();
+        dispatch_detected = 1;
+    }
+
+    return dispatch_features;
+#else
+    return 0;
+#endif
+}
+
+/**
+* @brief Bind the dispatched batch kernels to the best set the host supports.
+* Called automatically at load time; call it again to restrict the choice, e.g. for testing.
+* @param allowed LA_CPU_* flags the kernels may use, LA_CPU_ALL for no restriction
+* @return uint32_t LA_CPU_AVX2 if the AVX2 kernels were bound, 0 for the base kernels
+**/
+uint32_t LibAxis_Dispatch_Init(uint32_t allowed) {
+#if LA_DISPATCH
+    if (LibAxis_Cpu_Features() & allowed & LA_CPU_AVX2) {
+        dispatch_table = dispatch_avx2;
+        return LA_CPU_AVX2;
+    }
+
+    dispatch_table = dispatch_base;
+#else
+    (void)allowed;
+#endif
+    return 0;
+}
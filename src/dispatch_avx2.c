@@ -0,0 +1,20 @@
+/**
+ * @file: dispatch_avx2.c
+ * @author: CrookedPoe (https://github.com/CrookedPoe)
+ *
+ * @brief The dispatched batch kernels, built again for AVX2 hosts.
+**/
+
+/* The target has to be switched before lasimd.h is seen, so LA_SIMD picks the 8-lane kernels. */
+#if (defined(__x86_64__) || defined(__i386__)) && !defined(LA_NO_DISPATCH)
+#pragma GCC target("avx2")
+
+#define LA_DISPATCH_VARIANT
+#define LA_KERNEL(NAME) NAME##_AVX2
+
+#include "lamath.c"
+#include "stream.c"
+#include "color.c"
+#include "matrix.c"
+#include "ray.c"
+#endif
@@ -0,0 +1,523 @@
+/**
+ * @file: fixed.c
+ * @author: CrookedPoe (https://github.com/CrookedPoe)
+ *
+ * @brief Integer-only Q16.16 and Q1.15 vector and matrix arithmetic.
+**/
+
+#include "../include/libaxis.h"
+
+/* 1 / sqrt(x) in Q2.14 at the middle of each 1/32 wide bin of x in [0.25, 3). */
+static const uint16_t fixed_rsqrt_seed[88] = {
+    31803, 30080, 28610, 27337, 26220, 25229, 24343, 23544, 22819, 22157, 21550,
+    20990, 20472, 19990, 19540, 19120, 18726, 18355, 18005, 17674, 17362, 17065,
+    16783, 16514, 16258, 16013, 15780, 15556, 15341, 15135, 14937, 14747, 14564,
+    14387, 14217, 14053, 13894, 13740, 13592, 13448, 13309, 13173, 13042, 12915,
+    12791, 12671, 12555, 12441, 12330, 12223, 12118, 12015, 11916, 11818, 11724,
+    11631, 11540, 11452, 11365, 11281, 11198, 11117, 11038, 10961, 10885, 10811,
+    10738, 10667, 10597, 10528, 10461, 10395, 10330, 10266, 10204, 10143, 10083,
+    10023, 9965, 9908, 9852, 9797, 9743, 9689, 9637, 9585, 9534, 9484
+};
+
+/* n must not be 0. The fallback is a binary search, since mips3 has no clz instruction. */
+LA_INLINE int32_t Fixed_LeadingZerosF(uint32_t n) {
+#if defined(__x86_64__) || defined(__i386__)
+    return __builtin_clz(n);
+#else
+    int32_t z = 0;
+
+    if (n <= 0x0000FFFF) { z += 16; n <<= 16; }
+    if (n <= 0x00FFFFFF) { z += 8; n <<= 8; }
+    if (n <= 0x0FFFFFFF) { z += 4; n <<= 4; }
+    if (n <= 0x3FFFFFFF) { z += 2; n <<= 2; }
+    return z + (int32_t)(n <= 0x7FFFFFFF);
+#endif
+}
+
+/* 1 / sqrt(x) in Q2.30 for x in Q2.30, x in [2^28, 3 * 2^30). Each Newton step doubles the 5 correct bits of the seed, so three fill all 30. */
+LA_INLINE uint32_t Fixed_RSqrtQ30F(uint32_t x, int32_t steps) {
+    uint32_t y = (uint32_t)fixed_rsqrt_seed[(x >> 25) - 8] << 16;
+    uint32_t y2, xy2;
+    int32_t n;
+
+    /* y' = y * (3 - x * y^2) / 2. Newton undershoots, so y stays below 2.0 and y^2 fits in 32 bits. */
+    for (n = 0; n < steps; n++) {
+        y2 = (uint32_t)(((uint64_t)y * y) >> 30);
+        xy2 = (uint32_t)(((uint64_t)x * y2) >> 30);
+        y = (uint32_t)(((uint64_t)y * (0xC0000000u - xy2)) >> 31);
+    }
+
+    return y;
+}
+
+/* Products are pre-shifted right by 2 so that four of them can be summed without overflowing 64 bits. */
+LA_INLINE int64_t Fixed_ProductF(int32_t a, int32_t b) {
+    return ((int64_t)a * b) >> 2;
+}
+
+/* Round a sum of Fixed_ProductF terms back to Q16.16 and saturate it. */
+LA_INLINE qs1616_t Fixed_NarrowF(int64_t sum) {
+    sum = (sum + 0x2000) >> 14;
+    if (sum > LA_Q16_MAX)
+        return LA_Q16_MAX;
+    if (sum < LA_Q16_MIN)
+        return LA_Q16_MIN;
+
+    return (qs1616_t)sum;
+}
+
+LA_INLINE qs1616_t Fixed_AddSatF(qs1616_t a, qs1616_t b) {
+    int64_t sum = (int64_t)a + b;
+
+    return (sum > LA_Q16_MAX) ? LA_Q16_MAX : (sum < LA_Q16_MIN) ? LA_Q16_MIN : (qs1616_t)sum;
+}
+
+LA_INLINE qs1616_t Fixed_SubSatF(qs1616_t a, qs1616_t b) {
+    int64_t diff = (int64_t)a - b;
+
+    return (diff > LA_Q16_MAX) ? LA_Q16_MAX : (diff < LA_Q16_MIN) ? LA_Q16_MIN : (qs1616_t)diff;
+}
+
+LA_INLINE qs115_t Fixed_SaturateQ15F(int32_t q) {
+    return (q > LA_Q15_MAX) ? LA_Q15_MAX : (q < LA_Q15_MIN) ? LA_Q15_MIN : (qs115_t)q;
+}
+
+/* Round a Q2.30 product or sum of products to Q1.15 and saturate it. */
+LA_INLINE qs115_t Fixed_NarrowQ15F(int32_t q) {
+    return Fixed_SaturateQ15F((q + 0x4000) >> 15);
+}
+
+/*
+ * Scale a vector to unit length. The magnitudes are shifted so the largest is in
+ * [2^30, 2^31); the shift cancels in v / |v|, so only x = |v|^2 / 2^62, which is
+ * in [0.25, 3), needs a reciprocal square root. Two Newton steps are enough for
+ * 16 fraction bits. shift is 45 for Q16.16 and 46 for Q1.15.
+ */
+LA_INLINE void Fixed_NormalizeF(int32_t v[3], int32_t shift) {
+    uint32_t a[3], m, y;
+    uint64_t sum;
+    int32_t k, s;
+
+    for (k = 0; k < 3; k++)
+        a[k] = (v[k] < 0) ? (0u - (uint32_t)v[k]) : (uint32_t)v[k];
+
+    m = a[0] | a[1] | a[2];
+    if (m == 0)
+        return;
+
+    s = Fixed_LeadingZerosF(m) - 1;
+    for (k = 0; k < 3; k++)
+        a[k] = (s < 0) ? (a[k] >> 1) : (a[k] << s);
+
+    sum = ((uint64_t)a[0] * a[0]) + ((uint64_t)a[1] * a[1]) + ((uint64_t)a[2] * a[2]);
+    y = Fixed_RSqrtQ30F((uint32_t)(sum >> 32), 2);
+
+    for (k = 0; k < 3; k++) {
+        m = (uint32_t)((((uint64_t)a[k] * y) + ((uint64_t)1 << (shift - 1))) >> shift);
+        v[k] = (v[k] < 0) ? -(int32_t)m : (int32_t)m;
+    }
+}
+
+/**
+* @brief Add two Q16.16 numbers, saturating on overflow.
+* @param a Q16.16 operand
+* @param b Q16.16 operand
+* @return qs1616_t a + b
+**/
+qs1616_t LibAxis_Fixed_AddSat(qs1616_t a, qs1616_t b) {
+    return Fixed_AddSatF(a, b);
+}
+
+/**
+* @brief Subtract two Q16.16 numbers, saturating on overflow.
+* @param a Q16.16 operand
+* @param b Q16.16 operand
+* @return qs1616_t a - b
+**/
+qs1616_t LibAxis_Fixed_SubSat(qs1616_t a, qs1616_t b) {
+    return Fixed_SubSatF(a, b);
+}
+
+/**
+* @brief Multiply two Q16.16 numbers, rounding to nearest and saturating on overflow.
+* @param a Q16.16 operand
+* @param b Q16.16 operand
+* @return qs1616_t a * b
+**/
+qs1616_t LibAxis_Fixed_MulSat(qs1616_t a, qs1616_t b) {
+    return Fixed_NarrowF(Fixed_ProductF(a, b));
+}
+
+/**
+* @brief Square root of a Q16.16 number, without floating point.
+* @param a Q16.16 operand
+* @return qs1616_t sqrt(a), or 0 if a <= 0
+**/
+qs1616_t LibAxis_Fixed_Sqrt(qs1616_t a) {
+    int32_t b, s;
+    uint32_t x, y;
+
+    if (a <= 0)
+        return 0;
+
+    /* a = x * 2^(14 - s) with x in [0.25, 1) as Q2.30 and s even, so sqrt(a) = x * y * 2^(7 - s / 2). */
+    b = 31 - Fixed_LeadingZerosF((uint32_t)a);
+    s = (28 - b) + ((28 - b) & 1);
+    x = (s < 0) ? ((uint32_t)a >> -s) : ((uint32_t)a << s);
+    y = Fixed_RSqrtQ30F(x, 3);
+    x = (uint32_t)(((uint64_t)x * y) >> 30);
+    s = 7 + (s / 2);
+
+    return (qs1616_t)((x + (1u << (s - 1))) >> s);
+}
+
+/**
+* @brief Reciprocal square root of a Q16.16 number, without floating point.
+* @param a Q16.16 operand
+* @return qs1616_t 1 / sqrt(a), or LA_Q16_MAX if a <= 0
+**/
+qs1616_t LibAxis_Fixed_RSqrt(qs1616_t a) {
+    int32_t b, s;
+    uint32_t y;
+
+    if (a <= 0)
+        return LA_Q16_MAX;
+
+    /* As LibAxis_Fixed_Sqrt, 1 / sqrt(a) = y * 2^((s - 14) / 2). */
+    b = 31 - Fixed_LeadingZerosF((uint32_t)a);
+    s = (28 - b) + ((28 - b) & 1);
+    y = Fixed_RSqrtQ30F((s < 0) ? ((uint32_t)a >> -s) : ((uint32_t)a << s), 3);
+    s = 21 - (s / 2);
+
+    return (qs1616_t)((y + (1u << (s - 1))) >> s);
+}
+
+/**
+* @brief Add two Q16.16 vectors, saturating each component.
+* @param out Output vector, may alias an input
+* @param lhs Q16.16 vector
+* @param rhs Q16.16 vector
+* @return void
+**/
+void LibAxis_Fixed_Vec3iAddSat(Vec3i* out, Vec3i* lhs, Vec3i* rhs) {
+    out->x = Fixed_AddSatF(lhs->x, rhs->x);
+    out->y = Fixed_AddSatF(lhs->y, rhs->y);
+    out->z = Fixed_AddSatF(lhs->z, rhs->z);
+}
+
+/**
+* @brief Subtract two Q16.16 vectors, saturating each component.
+* @param out Output vector, may alias an input
+* @param lhs Q16.16 vector
+* @param rhs Q16.16 vector
+* @return void
+**/
+void LibAxis_Fixed_Vec3iSubSat(Vec3i* out, Vec3i* lhs, Vec3i* rhs) {
+    out->x = Fixed_SubSatF(lhs->x, rhs->x);
+    out->y = Fixed_SubSatF(lhs->y, rhs->y);
+    out->z = Fixed_SubSatF(lhs->z, rhs->z);
+}
+
+/**
+* @brief Scale a Q16.16 vector, saturating each component.
+* @param out Output vector, may alias lhs
+* @param lhs Q16.16 vector
+* @param scale Q16.16 factor
+* @return void
+**/
+void LibAxis_Fixed_Vec3iScaleSat(Vec3i* out, Vec3i* lhs, qs1616_t scale) {
+    out->x = Fixed_NarrowF(Fixed_ProductF(lhs->x, scale));
+    out->y = Fixed_NarrowF(Fixed_ProductF(lhs->y, scale));
+    out->z = Fixed_NarrowF(Fixed_ProductF(lhs->z, scale));
+}
+
+/**
+* @brief Dot product of two Q16.16 vectors, accumulated in 64 bits.
+* @param lhs Q16.16 vector
+* @param rhs Q16.16 vector
+* @return qs1616_t The saturated dot product
+**/
+qs1616_t LibAxis_Fixed_Vec3iDot(Vec3i* lhs, Vec3i* rhs) {
+    return Fixed_NarrowF(Fixed_ProductF(lhs->x, rhs->x) + Fixed_ProductF(lhs->y, rhs->y) + Fixed_ProductF(lhs->z, rhs->z));
+}
+
+/**
+* @brief Cross product of two Q16.16 vectors, accumulated in 64 bits.
+* @param out Output vector, may alias an input
+* @param lhs Q16.16 vector
+* @param rhs Q16.16 vector
+* @return void
+**/
+void LibAxis_Fixed_Vec3iCross(Vec3i* out, Vec3i* lhs, Vec3i* rhs) {
+    Vec3i a = *lhs;
+    Vec3i b = *rhs;
+
+    out->x = Fixed_NarrowF(Fixed_ProductF(a.y, b.z) - Fixed_ProductF(a.z, b.y));
+    out->y = Fixed_NarrowF(Fixed_ProductF(a.z, b.x) - Fixed_ProductF(a.x, b.z));
+    out->z = Fixed_NarrowF(Fixed_ProductF(a.x, b.y) - Fixed_ProductF(a.y, b.x));
+}
+
+/**
+* @brief Scale a Q16.16 vector to unit length (LA_Q16_ONE) with an integer reciprocal square root.
+* Unlike Vec3i_Normalize, the fractional components are kept. A zero vector stays zero.
+* @param out Output vector, may alias lhs
+* @param lhs Q16.16 vector
+* @return void
+**/
+void LibAxis_Fixed_Vec3iNormalize(Vec3i* out, Vec3i* lhs) {
+    int32_t v[3] = {lhs->x, lhs->y, lhs->z};
+
+    Fixed_NormalizeF(v, 45);
+    out->x = v[0];
+    out->y = v[1];
+    out->z = v[2];
+}
+
+/**
+* @brief Add two Q1.15 vectors, saturating each component.
+* @param out Output vector, may alias an input
+* @param lhs Q1.15 vector
+* @param rhs Q1.15 vector
+* @return void
+**/
+void LibAxis_Fixed_Vec3sAddSat(Vec3s* out, Vec3s* lhs, Vec3s* rhs) {
+    out->x = Fixed_SaturateQ15F((int32_t)lhs->x + rhs->x);
+    out->y = Fixed_SaturateQ15F((int32_t)lhs->y + rhs->y);
+    out->z = Fixed_SaturateQ15F((int32_t)lhs->z + rhs->z);
+}
+
+/**
+* @brief Subtract two Q1.15 vectors, saturating each component.
+* @param out Output vector, may alias an input
+* @param lhs Q1.15 vector
+* @param rhs Q1.15 vector
+* @return void
+**/
+void LibAxis_Fixed_Vec3sSubSat(Vec3s* out, Vec3s* lhs, Vec3s* rhs) {
+    out->x = Fixed_SaturateQ15F((int32_t)lhs->x - rhs->x);
+    out->y = Fixed_SaturateQ15F((int32_t)lhs->y - rhs->y);
+    out->z = Fixed_SaturateQ15F((int32_t)lhs->z - rhs->z);
+}
+
+/**
+* @brief Multiply two Q1.15 vectors component by component, saturating -1 * -1 to LA_Q15_MAX.
+* @param out Output vector, may alias an input
+* @param lhs Q1.15 vector
+* @param rhs Q1.15 vector
+* @return void
+**/
+void LibAxis_Fixed_Vec3sMulSat(Vec3s* out, Vec3s* lhs, Vec3s* rhs) {
+    out->x = Fixed_NarrowQ15F((int32_t)lhs->x * rhs->x);
+    out->y = Fixed_NarrowQ15F((int32_t)lhs->y * rhs->y);
+    out->z = Fixed_NarrowQ15F((int32_t)lhs->z * rhs->z);
+}
+
+/**
+* @brief Scale a Q1.15 vector, saturating each component.
+* @param out Output vector, may alias lhs
+* @param lhs Q1.15 vector
+* @param scale Q1.15 factor
+* @return void
+**/
+void LibAxis_Fixed_Vec3sScaleSat(Vec3s* out, Vec3s* lhs, qs115_t scale) {
+    out->x = Fixed_NarrowQ15F((int32_t)lhs->x * scale);
+    out->y = Fixed_NarrowQ15F((int32_t)lhs->y * scale);
+    out->z = Fixed_NarrowQ15F((int32_t)lhs->z * scale);
+}
+
+/**
+* @brief Dot product of two Q1.15 vectors, e.g. the cosine between two unit normals.
+* @param lhs Q1.15 vector
+* @param rhs Q1.15 vector
+* @return qs115_t The saturated dot product
+**/
+qs115_t LibAxis_Fixed_Vec3sDot(Vec3s* lhs, Vec3s* rhs) {
+    /* Three Q2.30 products can sum to 3 * 2^30, past int32, so the sum is kept in 64 bits until it is rounded. */
+    int64_t sum = ((int64_t)lhs->x * rhs->x) + ((int64_t)lhs->y * rhs->y) + ((int64_t)lhs->z * rhs->z);
+
+    return Fixed_SaturateQ15F((int32_t)((sum + 0x4000) >> 15));
+}
+
+/**
+* @brief Cross product of two Q1.15 vectors.
+* @param out Output vector, may alias an input
+* @param lhs Q1.15 vector
+* @param rhs Q1.15 vector
+* @return void
+**/
+void LibAxis_Fixed_Vec3sCross(Vec3s* out, Vec3s* lhs, Vec3s* rhs) {
+    Vec3s a = *lhs;
+    Vec3s b = *rhs;
+
+    /* The difference of two Q2.30 products can reach 2^31, so both are halved first. */
+    out->x = Fixed_SaturateQ15F(((((int32_t)a.y * b.z) >> 1) - (((int32_t)a.z * b.y) >> 1) + 0x2000) >> 14);
+    out->y = Fixed_SaturateQ15F(((((int32_t)a.z * b.x) >> 1) - (((int32_t)a.x * b.z) >> 1) + 0x2000) >> 14);
+    out->z = Fixed_SaturateQ15F(((((int32_t)a.x * b.y) >> 1) - (((int32_t)a.y * b.x) >> 1) + 0x2000) >> 14);
+}
+
+/**
+* @brief Scale a Q1.15 vector to unit length (LA_Q15_MAX) with an integer reciprocal square root.
+* A zero vector stays zero.
+* @param out Output vector, may alias lhs
+* @param lhs Q1.15 vector, or any Vec3s direction
+* @return void
+**/
+void LibAxis_Fixed_Vec3sNormalize(Vec3s* out, Vec3s* lhs) {
+    int32_t v[3] = {lhs->x, lhs->y, lhs->z};
+
+    Fixed_NormalizeF(v, 46);
+    out->x = Fixed_SaturateQ15F(v[0]);
+    out->y = Fixed_SaturateQ15F(v[1]);
+    out->z = Fixed_SaturateQ15F(v[2]);
+}
+
+/**
+* @brief Convert a float matrix to Q16.16, truncating like qs1616().
+* @param mq The output Q16.16 matrix
+* @param mf The float matrix
+* @return void
+**/
+void LibAxis_Fixed_Matrix44FromMatrix44F(qs1616_t mq[4][4], float mf[4][4]) {
+    int32_t i, j;
+
+    for (i = 0; i < 4; i++) {
+        for (j = 0; j < 4; j++)
+            mq[i][j] = qs1616(mf[i][j]);
+    }
+}
+
+/**
+* @brief Convert a Q16.16 matrix to floats.
+* @param mf The output float matrix
+* @param mq The Q16.16 matrix
+* @return void
+**/
+void LibAxis_Fixed_Matrix44ToMatrix44F(float mf[4][4], qs1616_t mq[4][4]) {
+    int32_t i, j;
+
+    for (i = 0; i < 4; i++) {
+        for (j = 0; j < 4; j++)
+            mf[i][j] = LA_Q16_TOF(mq[i][j]);
+    }
+}
+
+/**
+* @brief Multiply two Q16.16 matrices (mq = mq_a * mq_b), saturating each element.
+* @param mq_a Q16.16 matrix
+* @param mq_b Q16.16 matrix
+* @param mq The output matrix, may alias either input
+* @return void
+**/
+void LibAxis_Fixed_Matrix44Multiply(qs1616_t mq_a[4][4], qs1616_t mq_b[4][4], qs1616_t mq[4][4]) {
+    qs1616_t out[4][4];
+    int32_t i, j;
+
+    for (i = 0; i < 4; i++) {
+        for (j = 0; j < 4; j++) {
+            out[i][j] = Fixed_NarrowF(Fixed_ProductF(mq_a[i][0], mq_b[0][j]) + Fixed_ProductF(mq_a[i][1], mq_b[1][j]) +
+                                      Fixed_ProductF(mq_a[i][2], mq_b[2][j]) + Fixed_ProductF(mq_a[i][3], mq_b[3][j]));
+        }
+    }
+
+    for (i = 0; i < 4; i++) {
+        for (j = 0; j < 4; j++)
+            mq[i][j] = out[i][j];
+    }
+}
+
+/**
+* @brief Transform a Q16.16 point by a Q16.16 matrix (out = (v, 1) * mq), saturating each component.
+* @param out Output point, may alias v
+* @param v Q16.16 point
+* @param mq Q16.16 matrix; its last column is ignored
+* @return void
+**/
+void LibAxis_Fixed_Matrix44TransformPoint(Vec3i* out, Vec3i* v, qs1616_t mq[4][4]) {
+    LibAxis_Fixed_Matrix44TransformPointArray(out, v, mq, 1);
+}
+
+/**
+* @brief Transform an array of Q16.16 points by one Q16.16 matrix, saturating each component.
+* @param out Output points, may alias in
+* @param in Q16.16 points
+* @param mq Q16.16 matrix; its last column is ignored
+* @param count Number of points
+* @return void
+**/
+void LibAxis_Fixed_Matrix44TransformPointArray(Vec3i* out, Vec3i* in, qs1616_t mq[4][4], uint32_t count) {
+    /* The translation row is brought to the scale of Fixed_ProductF once, outside the loop. */
+    int64_t tx = (int64_t)mq[3][0] << 14;
+    int64_t ty = (int64_t)mq[3][1] << 14;
+    int64_t tz = (int64_t)mq[3][2] << 14;
+    int32_t x, y, z;
+    uint32_t n;
+
+    for (n = 0; n < count; n++) {
+        x = in[n].x;
+        y = in[n].y;
+        z = in[n].z;
+        out[n].x = Fixed_NarrowF(Fixed_ProductF(x, mq[0][0]) + Fixed_ProductF(y, mq[1][0]) + Fixed_ProductF(z, mq[2][0]) + tx);
+        out[n].y = Fixed_NarrowF(Fixed_ProductF(x, mq[0][1]) + Fixed_ProductF(y, mq[1][1]) + Fixed_ProductF(z, mq[2][1]) + ty);
+        out[n].z = Fixed_NarrowF(Fixed_ProductF(x, mq[0][2]) + Fixed_ProductF(y, mq[1][2]) + Fixed_ProductF(z, mq[2][2]) + tz);
+    }
+}
+
+/**
+* @brief Split a Q16.16 matrix into the integer and fraction halves of a Mtx44, without going through float.
+* @param m The output fixed-point matrix
+* @param mq The Q16.16 matrix
+* @return void
+**/
+void LibAxis_Fixed_PackMatrix44(Mtx44* m, qs1616_t mq[4][4]) {
+#if LA_SIMD_FIXED
+    const LA_I16x8 int_lanes = {1, 3, 5, 7, 9, 11, 13, 15};
+    const LA_I16x8 frac_lanes = {0, 2, 4, 6, 8, 10, 12, 14};
+    LA_I16x8 qa, qb;
+    int32_t i;
+
+    for (i = 0; i < 4; i += 2) {
+        qa = (LA_I16x8)*(const LA_I32x4u*)mq[i];
+        qb = (LA_I16x8)*(const LA_I32x4u*)mq[i + 1];
+        *(LA_I16x8u*)&m->i[i * 4] = __builtin_shuffle(qa, qb, int_lanes);
+        *(LA_I16x8u*)&m->f[i * 4] = __builtin_shuffle(qa, qb, frac_lanes);
+    }
+#else
+    int32_t i, j;
+
+    for (i = 0; i < 4; i++) {
+        for (j = 0; j < 4; j++) {
+            m->i[(i * 4) + j] = (int16_t)(mq[i][j] >> 16);
+            m->f[(i * 4) + j] = (uint16_t)mq[i][j];
+        }
+    }
+#endif
+}
+
+/**
+* @brief Join the integer and fraction halves of a Mtx44 back into a Q16.16 matrix.
+* @param mq The output Q16.16 matrix
+* @param m The fixed-point matrix
+* @return void
+**/
+void LibAxis_Fixed_UnpackMatrix44(qs1616_t mq[4][4], Mtx44* m) {
+#if LA_SIMD_FIXED
+    const LA_I16x8 lo_lanes = {0, 8, 1, 9, 2, 10, 3, 11};
+    const LA_I16x8 hi_lanes = {4, 12, 5, 13, 6, 14, 7, 15};
+    LA_I16x8 ih, fh;
+    int32_t i;
+
+    for (i = 0; i < 4; i += 2) {
+        ih = *(const LA_I16x8u*)&m->i[i * 4];
+        fh = *(const LA_I16x8u*)&m->f[i * 4];
+        *(LA_I32x4u*)mq[i] = (LA_I32x4)__builtin_shuffle(fh, ih, lo_lanes);
+        *(LA_I32x4u*)mq[i + 1] = (LA_I32x4)__builtin_shuffle(fh, ih, hi_lanes);
+    }
+#else
+    int32_t i, j;
+
+    for (i = 0; i < 4; i++) {
+        for (j = 0; j < 4; j++)
+            mq[i][j] = (qs1616_t)(((uint32_t)(uint16_t)m->i[(i * 4) + j] << 16) | m->f[(i * 4) + j]);
+    }
+#endif
+}
@@ -0,0 +1,202 @@
+/**
+ * @file: frustum.c
+ * @author: CrookedPoe (https://github.com/CrookedPoe)
+ *
+ * @brief View-frustum plane extraction and sphere/AABB culling.
+**/
+
+#include "../include/libaxis.h"
+
+/* Append first + k for every bit k set in bits. Each slot is written unconditionally and kept only when its bit is set, so there is no branch per lane. */
+static uint32_t Frustum_EmitF(uint32_t* visible, uint32_t n, uint32_t first, uint32_t bits) {
+    uint32_t k;
+
+    for (k = 0; k < LA_SIMD_WIDTH; k++) {
+        visible[n] = first + k;
+        n += (bits >> k) & 1;
+    }
+
+    return n;
+}
+
+/* Broadcast every plane component into its own vector once, rather than once per group of objects. */
+static void Frustum_SplatF(LA_F32xN planes[LA_FRUSTUM_PLANES][4], Frustum* frustum) {
+    int32_t n;
+
+    for (n = 0; n < LA_FRUSTUM_PLANES; n++) {
+        planes[n][0] = frustum->plane[n].x + (LA_F32xN){0};
+        planes[n][1] = frustum->plane[n].y + (LA_F32xN){0};
+        planes[n][2] = frustum->plane[n].z + (LA_F32xN){0};
+        planes[n][3] = frustum->plane[n].w + (LA_F32xN){0};
+    }
+}
+
+/**
+* @brief Extract and normalize the six planes of a combined view-projection matrix.
+* @param frustum Output planes, see LA_FRUSTUM_LEFT..LA_FRUSTUM_FAR
+* @param mf View-projection matrix (clip = v * mf)
+* @return void
+**/
+void LibAxis_Frustum_FromMatrix44F(Frustum* frustum, float mf[4][4]) {
+    static const int8_t column[LA_FRUSTUM_PLANES] = {0, 0, 1, 1, 2, 2};
+    Vec4f* p;
+    float sign, scale;
+    int32_t n, c;
+
+    /* Plane n is column 3 plus or minus column 0, 1 or 2 (Gribb & Hartmann). */
+    for (n = 0; n < LA_FRUSTUM_PLANES; n++) {
+        p = &frustum->plane[n];
+        c = column[n];
+        sign = (n & 1) ? -1.0f : 1.0f;
+
+        p->x = mf[0][3] + (mf[0][c] * sign);
+        p->y = mf[1][3] + (mf[1][c] * sign);
+        p->z = mf[2][3] + (mf[2][c] * sign);
+        p->w = mf[3][3] + (mf[3][c] * sign);
+
+        scale = LibAxis_SqrtF((p->x * p->x) + (p->y * p->y) + (p->z * p->z));
+        if (scale > 0.0f) {
+            scale = 1.0f / scale;
+            p->x *= scale;
+            p->y *= scale;
+            p->z *= scale;
+            p->w *= scale;
+        }
+    }
+}
+
+/**
+* @brief Test a bounding sphere against a frustum.
+* @param frustum Frustum planes
+* @param center Sphere center
+* @param radius Sphere radius
+* @return int32_t 1 if the sphere is at least partly inside, otherwise 0
+**/
+int32_t LibAxis_Frustum_TestSphere(Frustum* frustum, Vec3f* center, float radius) {
+    Vec4f* p;
+    int32_t n;
+
+    for (n = 0; n < LA_FRUSTUM_PLANES; n++) {
+        p = &frustum->plane[n];
+        if (!(((center->x * p->x) + (center->y * p->y) + (center->z * p->z) + p->w) >= -radius))
+            return 0;
+    }
+
+    return 1;
+}
+
+/**
+* @brief Test an axis-aligned bounding box against a frustum.
+* Only the corner furthest along each plane normal is tested, so boxes near a frustum
+* corner may be kept even though they are outside; they are never wrongly rejected.
+* @param frustum Frustum planes
+* @param min Minimum corner of the box
+* @param max Maximum corner of the box
+* @return int32_t 1 if the box is at least partly inside, otherwise 0
+**/
+int32_t LibAxis_Frustum_TestAABB(Frustum* frustum, Vec3f* min, Vec3f* max) {
+    Vec4f* p;
+    int32_t n;
+
+    for (n = 0; n < LA_FRUSTUM_PLANES; n++) {
+        p = &frustum->plane[n];
+        if (!(((((p->x >= 0.0f) ? max->x : min->x) * p->x) + (((p->y >= 0.0f) ? max->y : min->y) * p->y) +
+               (((p->z >= 0.0f) ? max->z : min->z) * p->z) + p->w) >= 0.0f))
+            return 0;
+    }
+
+    return 1;
+}
+
+/**
+* @brief Cull an array of bounding spheres, LA_SIMD_WIDTH spheres per iteration.
+* @param frustum Frustum planes
+* @param visible Output indices of the visible spheres, room for center->count entries
+* @param center Sphere centers
+* @param radius center->count sphere radii
+* @return uint32_t Number of visible spheres
+**/
+uint32_t LibAxis_Frustum_CullSpheres(Frustum* frustum, uint32_t* visible, Vec3fStream* center, float* radius) {
+    uint32_t count = center->count;
+    uint32_t i, bits, n = 0;
+    LA_F32xN p[LA_FRUSTUM_PLANES][4];
+    LA_F32xN x, y, z, r;
+    LA_I32xN inside;
+    int32_t k;
+    Vec3f c;
+
+    Frustum_SplatF(p, frustum);
+
+    for (i = 0; i + LA_SIMD_WIDTH <= count; i += LA_SIMD_WIDTH) {
+        x = LA_LOADN(&center->x[i]);
+        y = LA_LOADN(&center->y[i]);
+        z = LA_LOADN(&center->z[i]);
+        r = -LA_LOADN(&radius[i]);
+
+        inside = ((x * p[0][0]) + (y * p[0][1]) + (z * p[0][2]) + p[0][3]) >= r;
+        for (k = 1; k < LA_FRUSTUM_PLANES; k++)
+            inside &= ((x * p[k][0]) + (y * p[k][1]) + (z * p[k][2]) + p[k][3]) >= r;
+
+        /* Most objects of a large world are outside, so groups with nothing visible skip the emit. */
+        bits = LA_MaskBitsN(inside);
+        if (bits != 0)
+            n = Frustum_EmitF(visible, n, i, bits);
+    }
+
+    for (; i < count; i++) {
+        c = VEC3F_NEW(center->x[i], center->y[i], center->z[i]);
+        visible[n] = i;
+        n += (uint32_t)LibAxis_Frustum_TestSphere(frustum, &c, radius[i]);
+    }
+
+    return n;
+}
+
+/**
+* @brief Cull an array of axis-aligned bounding boxes, LA_SIMD_WIDTH boxes per iteration.
+* @param frustum Frustum planes
+* @param visible Output indices of the visible boxes, room for min->count entries
+* @param min Minimum corners
+* @param max Maximum corners, same count as min
+* @return uint32_t Number of visible boxes
+**/
+uint32_t LibAxis_Frustum_CullAABBs(Frustum* frustum, uint32_t* visible, Vec3fStream* min, Vec3fStream* max) {
+    uint32_t count = min->count;
+    uint32_t i, bits, n = 0;
+    LA_F32xN x0, y0, z0, x1, y1, z1;
+    LA_I32xN inside;
+    Vec4f* p;
+    int32_t k;
+    Vec3f lo, hi;
+
+    for (i = 0; i + LA_SIMD_WIDTH <= count; i += LA_SIMD_WIDTH) {
+        x0 = LA_LOADN(&min->x[i]);
+        y0 = LA_LOADN(&min->y[i]);
+        z0 = LA_LOADN(&min->z[i]);
+        x1 = LA_LOADN(&max->x[i]);
+        y1 = LA_LOADN(&max->y[i]);
+        z1 = LA_LOADN(&max->z[i]);
+
+        /* The corner to test depends only on the plane's signs, so it is picked per plane rather than per lane. */
+        p = &frustum->plane[0];
+        inside = ((((p->x >= 0.0f) ? x1 : x0) * p->x) + (((p->y >= 0.0f) ? y1 : y0) * p->y) + (((p->z >= 0.0f) ? z1 : z0) * p->z) + p->w) >= 0.0f;
+        for (k = 1; k < LA_FRUSTUM_PLANES; k++) {
+            p = &frustum->plane[k];
+            inside &= ((((p->x >= 0.0f) ? x1 : x0) * p->x) + (((p->y >= 0.0f) ? y1 : y0) * p->y) + (((p->z >= 0.0f) ? z1 : z0) * p->z) + p->w) >= 0.0f;
+        }
+
+        /* Most objects of a large world are outside, so groups with nothing visible skip the emit. */
+        bits = LA_MaskBitsN(inside);
+        if (bits != 0)
+            n = Frustum_EmitF(visible, n, i, bits);
+    }
+
+    for (; i < count; i++) {
+        lo = VEC3F_NEW(min->x[i], min->y[i], min->z[i]);
+        hi = VEC3F_NEW(max->x[i], max->y[i], max->z[i]);
+        visible[n] = i;
+        n += (uint32_t)LibAxis_Frustum_TestAABB(frustum, &lo, &hi);
+    }
+
+    return n;
+}
\ No newline at end of file
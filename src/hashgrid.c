@@ -0,0 +1,229 @@
+/**
+ * @file: hashgrid.c
+ * @author: CrookedPoe (https://github.com/CrookedPoe)
+ *
+ * @brief Spatial hash grid for broad-phase neighbor queries.
+**/
+
+#include "../include/libaxis.h"
+
+#define HASHGRID_NONE 0xFFFFFFFF
+
+/* Round towards negative infinity; Vec3i_FromVec3f truncates, which would merge the cells either side of 0. */
+LA_INLINE int32_t HashGrid_FloorF(float f) {
+    int32_t i = (int32_t)f;
+
+    return i - (int32_t)(f < (float)i);
+}
+
+LA_INLINE Vec3i HashGrid_CellF(HashGrid* grid, Vec3f* p) {
+    return VEC3I_NEW(HashGrid_FloorF(p->x * grid->inverse), HashGrid_FloorF(p->y * grid->inverse), HashGrid_FloorF(p->z * grid->inverse));
+}
+
+/* Teschner et al. spatial hash. */
+LA_INLINE uint32_t HashGrid_HashF(HashGrid* grid, int32_t x, int32_t y, int32_t z) {
+    return (((uint32_t)x * 73856093u) ^ ((uint32_t)y * 19349663u) ^ ((uint32_t)z * 83492791u)) & grid->mask;
+}
+
+/* Slot of cell (x, y, z), or HASHGRID_NONE if it holds no points. */
+LA_INLINE uint32_t HashGrid_FindF(HashGrid* grid, int32_t x, int32_t y, int32_t z) {
+    uint32_t s = HashGrid_HashF(grid, x, y, z);
+    HashGridCell* c;
+
+    for (;; s = (s + 1) & grid->mask) {
+        c = &grid->cells[s];
+        if (c->count == 0)
+            return HASHGRID_NONE;
+        if (c->cell.x == x && c->cell.y == y && c->cell.z == z)
+            return s;
+    }
+}
+
+/* Append the points of slot s within radius of p (squared) to out, skipping sorted indices below first. */
+LA_INLINE uint32_t HashGrid_GatherF(HashGrid* grid, uint32_t s, uint32_t first, Vec3f* p, float radius_sq, uint32_t* out, uint32_t n, uint32_t max_out) {
+    HashGridCell* c = &grid->cells[s];
+    uint32_t k = (first > c->start) ? first : c->start;
+    Vec3f* q;
+    float dx, dy, dz;
+
+    for (; k < c->start + c->count && n < max_out; k++) {
+        q = &grid->sorted[k];
+        dx = q->x - p->x;
+        dy = q->y - p->y;
+        dz = q->z - p->z;
+        out[n] = k;
+        n += (((dx * dx) + (dy * dy) + (dz * dz)) <= radius_sq);
+    }
+
+    return n;
+}
+
+/**
+* @brief Point the arrays of a HashGrid into a single buffer and empty it.
+* @param grid The grid to initialize
+* @param buffer At least LA_HASHGRID_BYTES(capacity) bytes, 4 byte aligned
+* @param capacity Maximum number of points, at least 1
+* @param cell_size Edge length of a cell; queries are fastest when their radius is at most this
+* @return void
+**/
+void LibAxis_HashGrid_Init(HashGrid* grid, void* buffer, uint32_t capacity, float cell_size) {
+    uint32_t slots = 1;
+    uint32_t s;
+
+    while (slots < capacity * 2)
+        slots <<= 1;
+
+    grid->cells = (HashGridCell*)buffer;
+    grid->order = (uint32_t*)(grid->cells + (capacity * 4));
+    grid->slot = grid->order + capacity;
+    grid->index = grid->slot + capacity;
+    grid->sorted = (Vec3f*)(grid->index + capacity);
+    grid->cell_size = cell_size;
+    grid->inverse = 1.0f / cell_size;
+    grid->mask = slots - 1;
+    grid->cell_count = 0;
+    grid->count = 0;
+    grid->capacity = capacity;
+
+    for (s = 0; s < slots; s++)
+        grid->cells[s].count = 0;
+}
+
+/**
+* @brief Replace the contents of the grid with a new set of points, sorted by cell in O(count).
+* @param grid Initialized grid
+* @param points Positions to insert; they are copied
+* @param count Number of points, at most grid->capacity
+* @return uint32_t Number of occupied cells, or 0 if count is 0 or too large
+**/
+uint32_t LibAxis_HashGrid_Build(HashGrid* grid, Vec3f* points, uint32_t count) {
+    HashGridCell* c;
+    Vec3i key;
+    uint32_t i, s, start;
+
+    /* Only the cells of the previous build can be occupied. */
+    for (i = 0; i < grid->cell_count; i++)
+        grid->cells[grid->order[i]].count = 0;
+
+    grid->cell_count = 0;
+    grid->count = 0;
+    if (count == 0 || count > grid->capacity)
+        return 0;
+
+    /* Count the points of every cell, claiming a slot the first time a cell is seen. */
+    for (i = 0; i < count; i++) {
+        key = HashGrid_CellF(grid, &points[i]);
+        for (s = HashGrid_HashF(grid, key.x, key.y, key.z);; s = (s + 1) & grid->mask) {
+            c = &grid->cells[s];
+            if (c->count == 0) {
+                c->cell = key;
+                grid->order[grid->cell_count++] = s;
+                break;
+            }
+            if (c->cell.x == key.x && c->cell.y == key.y && c->cell.z == key.z)
+                break;
+        }
+
+        c->count++;
+        grid->slot[i] = s;
+    }
+
+    /* Each cell's start is set to its end; the scatter below counts it back down to the start. */
+    for (i = 0, start = 0; i < grid->cell_count; i++) {
+        c = &grid->cells[grid->order[i]];
+        start += c->count;
+        c->start = start;
+    }
+
+    for (i = count; i-- > 0;) {
+        s = --grid->cells[grid->slot[i]].start;
+        grid->index[s] = i;
+        grid->sorted[s] = points[i];
+    }
+
+    grid->count = count;
+    return grid->cell_count;
+}
+
+/**
+* @brief Collect every point within radius of center.
+* @param grid Built grid
+* @param center Query center
+* @param radius Query radius
+* @param out Output point indices, as passed to LibAxis_HashGrid_Build
+* @param max_out Capacity of out; the query stops once it is full
+* @return uint32_t Number of indices written
+**/
+uint32_t LibAxis_HashGrid_QueryRadius(HashGrid* grid, Vec3f* center, float radius, uint32_t* out, uint32_t max_out) {
+    Vec3f lo = VEC3F_NEW(center->x - radius, center->y - radius, center->z - radius);
+    Vec3f hi = VEC3F_NEW(center->x + radius, center->y + radius, center->z + radius);
+    Vec3i a = HashGrid_CellF(grid, &lo);
+    Vec3i b = HashGrid_CellF(grid, &hi);
+    uint32_t i, s, n = 0;
+    int32_t x, y, z;
+
+    if (grid->count == 0)
+        return 0;
+
+    for (z = a.z; z <= b.z; z++) {
+        for (y = a.y; y <= b.y; y++) {
+            for (x = a.x; x <= b.x; x++) {
+                s = HashGrid_FindF(grid, x, y, z);
+                if (s != HASHGRID_NONE)
+                    n = HashGrid_GatherF(grid, s, 0, center, radius * radius, out, n, max_out);
+            }
+        }
+    }
+
+    /* Gathered as sorted positions; translate back to the caller's indices. */
+    for (i = 0; i < n; i++)
+        out[i] = grid->index[out[i]];
+
+    return n;
+}
+
+/**
+* @brief Enumerate every pair of points within radius of each other, each pair once.
+* @param grid Built grid
+* @param radius Pair distance
+* @param pairs Output pairs of point indices, two entries per pair
+* @param max_pairs Capacity of pairs, in pairs; the search stops once it is full
+* @return uint32_t Number of pairs written
+**/
+uint32_t LibAxis_HashGrid_Pairs(HashGrid* grid, float radius, uint32_t* pairs, uint32_t max_pairs) {
+    int32_t reach = -HashGrid_FloorF(-radius * grid->inverse);
+    float radius_sq = radius * radius;
+    HashGridCell* c;
+    uint32_t i, k, s, m, found, n = 0;
+    int32_t x, y, z;
+
+    for (i = 0; i < grid->cell_count; i++) {
+        c = &grid->cells[grid->order[i]];
+
+        /* The forward half of the neighbor block, plus each point's successors in its own cell, see every pair once. */
+        for (z = 0; z <= reach; z++) {
+            for (y = (z == 0) ? 0 : -reach; y <= reach; y++) {
+                for (x = (z == 0 && y == 0) ? 0 : -reach; x <= reach; x++) {
+                    s = (x == 0 && y == 0 && z == 0) ? grid->order[i] : HashGrid_FindF(grid, c->cell.x + x, c->cell.y + y, c->cell.z + z);
+                    if (s == HASHGRID_NONE)
+                        continue;
+
+                    for (k = c->start; k < c->start + c->count; k++) {
+                        /* Partners are gathered into the free tail of pairs, then spread out behind their first index. */
+                        found = HashGrid_GatherF(grid, s, (s == grid->order[i]) ? (k + 1) : 0, &grid->sorted[k], radius_sq, &pairs[n * 2], 0, max_pairs - n);
+                        for (m = found; m-- > 0;) {
+                            pairs[((n + m) * 2) + 1] = grid->index[pairs[(n * 2) + m]];
+                            pairs[(n + m) * 2] = grid->index[k];
+                        }
+
+                        n += found;
+                        if (n == max_pairs)
+                            return n;
+                    }
+                }
+            }
+        }
+    }
+
+    return n;
+}
\ No newline at end of file
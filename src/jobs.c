@@ -0,0 +1,240 @@
+/**
+ * @file: jobs.c
+ * @author: CrookedPoe (https://github.com/CrookedPoe)
+ *
+ * @brief Work-stealing parallel-for over host-provided worker threads.
+**/
+
+#include "../include/libaxis.h"
+
+/* Queues are claimed with 64-bit compare-exchange; without it every job runs inline. */
+#if defined(__GCC_ATOMIC_LLONG_LOCK_FREE) && (__GCC_ATOMIC_LLONG_LOCK_FREE == 2)
+#define JOBS_THREADED 1
+#else
+#define JOBS_THREADED 0
+#endif
+
+#define JOBS_TAG(GENERATION) ((uint64_t)((GENERATION) & 0xFFFF) << 48)
+#define JOBS_TAG_MASK (0xFFFFull << 48)
+
+/* Run every chunk on the calling thread, in order. */
+static void Jobs_RunInlineF(JobFunc func, void* data, uint32_t count, uint32_t chunk, uint32_t chunks) {
+    uint32_t c, begin;
+
+    for (c = 0; c < chunks; c++) {
+        begin = c * chunk;
+        func(data, begin, (count - begin > chunk) ? begin + chunk : count, 0);
+    }
+}
+
+#if JOBS_THREADED
+
+LA_INLINE void Jobs_IdleF(JobSystem* jobs) {
+    void (*idle)(void) = jobs->idle;
+
+    if (idle != NULL) {
+        idle();
+        return;
+    }
+#if defined(__i386__) || defined(__x86_64__)
+    __builtin_ia32_pause();
+#endif
+}
+
+/* Take one chunk of the job tagged tag from the front of a queue, or from the back when stealing. */
+LA_INLINE int32_t Jobs_ClaimF(JobQueue* queue, uint64_t tag, int32_t steal, uint32_t* c) {
+    uint64_t range = __atomic_load_n(&queue->range, __ATOMIC_RELAXED);
+    uint32_t first, end;
+
+    do {
+        if ((range & JOBS_TAG_MASK) != tag)
+            return 0;
+
+        first = (uint32_t)(range >> 24) & LA_JOBS_MAX_CHUNKS;
+        end = (uint32_t)range & LA_JOBS_MAX_CHUNKS;
+        if (first >= end)
+            return 0;
+
+        if (steal)
+            *c = --end;
+        else
+            *c = first++;
+    } while (!__atomic_compare_exchange_n(&queue->range, &range, tag | ((uint64_t)first << 24) | end, 1, __ATOMIC_RELAXED, __ATOMIC_RELAXED));
+
+    return 1;
+}
+
+/* Work on job generation until no queue has a chunk of it left. */
+static void Jobs_RunF(JobSystem* jobs, uint32_t worker, uint32_t generation) {
+    uint64_t tag = JOBS_TAG(generation);
+    uint32_t workers = jobs->worker_count;
+    JobFunc func = __atomic_load_n(&jobs->func, __ATOMIC_RELAXED);
+    void* data = __atomic_load_n(&jobs->data, __ATOMIC_RELAXED);
+    uint32_t count = __atomic_load_n(&jobs->count, __ATOMIC_RELAXED);
+    uint32_t chunk = __atomic_load_n(&jobs->chunk, __ATOMIC_RELAXED);
+    uint32_t c = 0;
+    uint32_t i, begin;
+
+    /*
+     * The issuer retags every queue before it overwrites the fields above, so
+     * if they were read from a newer job, the claims below see the new tag and
+     * fail, and nothing runs with them. A worker stays counted in active while
+     * it is in here, which keeps the tags it can meet to this job and the next,
+     * far from the 16-bit wrap.
+     */
+    __atomic_thread_fence(__ATOMIC_ACQUIRE);
+
+    for (;;) {
+        if (!Jobs_ClaimF(&jobs->queues[worker], tag, 0, &c)) {
+            for (i = 1; i < workers; i++) {
+                if (Jobs_ClaimF(&jobs->queues[(worker + i) % workers], tag, 1, &c))
+                    break;
+            }
+            if (i == workers)
+                return;
+        }
+
+        begin = c * chunk;
+        func(data, begin, (count - begin > chunk) ? begin + chunk : count, worker);
+        __atomic_fetch_add(&jobs->done, 1, __ATOMIC_RELEASE);
+    }
+}
+
+#endif /* JOBS_THREADED */
+
+/**
+* @brief Point a JobSystem at its queues. Start the worker threads after this.
+* @param jobs The job system to initialize
+* @param buffer At least LA_JOBS_BYTES(worker_count) bytes, 64 byte aligned
+* @param worker_count Number of workers including the thread that issues jobs, at least 1
+* @param idle Called while a worker waits for work, or NULL to spin with a CPU pause
+* @return void
+**/
+void LibAxis_Jobs_Init(JobSystem* jobs, void* buffer, uint32_t worker_count, void (*idle)(void)) {
+    uint32_t w;
+
+    jobs->queues = (JobQueue*)buffer;
+    jobs->idle = idle;
+    jobs->func = NULL;
+    jobs->data = NULL;
+    jobs->count = 0;
+    jobs->chunk = 1;
+    jobs->chunks = 0;
+    jobs->done = 0;
+    jobs->generation = 0;
+    jobs->active = 0;
+    jobs->quit = 0;
+    jobs->worker_count = (worker_count > 0) ? worker_count : 1;
+
+    for (w = 0; w < jobs->worker_count; w++)
+        jobs->queues[w].range = 0;
+}
+
+/**
+* @brief Run func over [0, count) in chunks spread across the workers, and return when every chunk is done.
+* @param jobs The job system
+* @param func Called once per chunk with its [begin, end) range and the index of the worker running it
+* @param data Passed to func
+* @param count Number of elements
+* @param chunk Elements per chunk; a multiple of LA_SIMD_WIDTH keeps batch kernels off their scalar tails
+* @return void
+**/
+void LibAxis_Jobs_ParallelFor(JobSystem* jobs, JobFunc func, void* data, uint32_t count, uint32_t chunk) {
+    uint32_t chunks;
+#if JOBS_THREADED
+    uint32_t workers = jobs->worker_count;
+    uint32_t generation, w, share, extra, first, end;
+    uint64_t tag;
+#endif
+
+    if (count == 0)
+        return;
+
+    if (chunk == 0)
+        chunk = 1;
+
+    /* Only reached past 16M chunks, and still a function of count and chunk alone. */
+    chunks = ((count - 1) / chunk) + 1;
+    if (chunks > LA_JOBS_MAX_CHUNKS) {
+        chunk = ((count - 1) / LA_JOBS_MAX_CHUNKS) + 1;
+        chunks = ((count - 1) / chunk) + 1;
+    }
+
+#if JOBS_THREADED
+    if (workers > 1 && chunks > 1) {
+        generation = jobs->generation + 1;
+        tag = JOBS_TAG(generation);
+
+        /* Workers still leaving the last job may hold its fields; let them go before retagging. */
+        while (__atomic_load_n(&jobs->active, __ATOMIC_SEQ_CST) != 0)
+            Jobs_IdleF(jobs);
+
+        /* The first chunks % workers workers take one chunk more than the rest. */
+        share = chunks / workers;
+        extra = chunks % workers;
+        for (w = 0, first = 0; w < workers; w++, first = end) {
+            end = first + share + (w < extra);
+            __atomic_store_n(&jobs->queues[w].range, tag | ((uint64_t)first << 24) | end, __ATOMIC_RELAXED);
+        }
+
+        __atomic_thread_fence(__ATOMIC_RELEASE);
+        __atomic_store_n(&jobs->func, func, __ATOMIC_RELAXED);
+        __atomic_store_n(&jobs->data, data, __ATOMIC_RELAXED);
+        __atomic_store_n(&jobs->count, count, __ATOMIC_RELAXED);
+        __atomic_store_n(&jobs->chunk, chunk, __ATOMIC_RELAXED);
+        __atomic_store_n(&jobs->done, 0, __ATOMIC_RELAXED);
+        jobs->chunks = chunks;
+        __atomic_store_n(&jobs->generation, generation, __ATOMIC_RELEASE);
+
+        Jobs_RunF(jobs, 0, generation);
+        while (__atomic_load_n(&jobs->done, __ATOMIC_ACQUIRE) != chunks)
+            Jobs_IdleF(jobs);
+
+        return;
+    }
+#endif
+
+    Jobs_RunInlineF(func, data, count, chunk, chunks);
+}
+
+/**
+* @brief Body of a host worker thread: run chunks of every job issued until LibAxis_Jobs_Stop.
+* @param jobs The job system
+* @param worker Index of this worker, 1 to worker_count - 1
+* @return void
+**/
+void LibAxis_Jobs_Worker(JobSystem* jobs, uint32_t worker) {
+#if JOBS_THREADED
+    uint32_t seen = 0;
+    uint32_t generation;
+
+    if (worker == 0 || worker >= jobs->worker_count)
+        return;
+
+    for (;;) {
+        generation = __atomic_load_n(&jobs->generation, __ATOMIC_ACQUIRE);
+        if (generation != seen) {
+            /* Count in first, then read the generation again: it can be at most one job behind the issuer now. */
+            __atomic_fetch_add(&jobs->active, 1, __ATOMIC_SEQ_CST);
+            seen = __atomic_load_n(&jobs->generation, __ATOMIC_SEQ_CST);
+            Jobs_RunF(jobs, worker, seen);
+            __atomic_fetch_sub(&jobs->active, 1, __ATOMIC_RELEASE);
+            continue;
+        }
+
+        if (__atomic_load_n(&jobs->quit, __ATOMIC_RELAXED))
+            return;
+
+        Jobs_IdleF(jobs);
+    }
+#endif
+}
+
+/**
+* @brief Make every LibAxis_Jobs_Worker return once it is idle, so the host can join its threads.
+* @param jobs The job system
+* @return void
+**/
+void LibAxis_Jobs_Stop(JobSystem* jobs) {
+    __atomic_store_n(&jobs->quit, 1, __ATOMIC_RELEASE);
+}
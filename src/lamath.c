@@ -7,6 +7,8 @@
 
 #include "../include/libaxis.h"
 
+/* dispatch_avx2.c includes this file again with LA_DISPATCH_VARIANT defined, to rebuild only the batch kernels. */
+#ifndef LA_DISPATCH_VARIANT
 /**
 * @brief Determine the smallest value from a set of 3.
 * @param a
@@ -97,6 +99,115 @@ int32_t LibAxis_Abs(int32_t n) {
     return (n < 0) ? -n : n;
 }
 
+/* 2/pi as a binary fraction, 32 bits per word, after a zero word so a window can start before the binary point. */
+static const uint32_t Trig_TwoOverPi[9] = {
+    0x00000000, 0xA2F9836E, 0x4E441529, 0xFC2757D1, 0xF534DDC0, 0xDB629599, 0x3C439041, 0xFE5163AB, 0xDEBBC561
+};
+
+/**
+* @brief Reduce an angle of any size by pi/2 (Payne-Hanek), for arguments past LA_TRIG_REDUCE_MAX.
+* Only the bits of 2/pi that can reach the two integer bits and the fraction of x * 2/pi are multiplied in,
+* with 32 bit limbs, so no precision is lost however large x is.
+* 
+* @param x Angle in radians
+* @param quadrant Nearest multiple of pi/2, modulo 4
+* @return float x minus quadrant * pi/2, in [-pi/4, pi/4]; NaN for inf or NaN
+**/
+float LibAxis_TrigReduceLargeF(float x, int32_t* quadrant) {
+    union {
+        float f;
+        uint32_t i;
+    } v;
+    uint32_t m, t, word, shift, k, r0, r1, r2, q;
+    uint32_t w[3];
+    uint64_t p, frac;
+    double r;
+
+    v.f = x;
+    *quadrant = 0;
+    if (((v.i >> 23) & 0xFF) == 0xFF)
+        return x - x;
+
+    /* Below 2^-7 the window would start before the table, and x is already reduced. */
+    if (((v.i >> 23) & 0xFF) < 120)
+        return x;
+
+    /*
+     * |x| = m * 2^(e - 150), so x * 2/pi mod 4 only depends on the bits of 2/pi from
+     * weight 2^(152 - e) down; t is where they start in Trig_TwoOverPi.
+     */
+    m = (v.i & 0x7FFFFF) | 0x800000;
+    t = ((v.i >> 23) & 0xFF) - 120;
+    word = t >> 5;
+    shift = t & 31;
+
+    for (k = 0; k < 3; k++)
+        w[k] = (Trig_TwoOverPi[word + k] << shift) | (shift ? (Trig_TwoOverPi[word + k + 1] >> (32 - shift)) : 0);
+
+    /* 96 bit fraction of m * w; its top two bits are the quadrant. */
+    p = (uint64_t)m * w[2];
+    r2 = (uint32_t)p;
+    p = ((uint64_t)m * w[1]) + (p >> 32);
+    r1 = (uint32_t)p;
+    r0 = (m * w[0]) + (uint32_t)(p >> 32);
+
+    /* Round to the nearest quadrant: a fraction >= 1/2 reads as negative in two's complement. */
+    frac = (((((uint64_t)r0) << 32) | r1) << 2) | (r2 >> 30);
+    q = ((r0 >> 30) + (uint32_t)(frac >> 63)) & 3;
+    r = (((double)(int32_t)(frac >> 32) * 4294967296.0) + (double)(uint32_t)frac) * 8.515303950216386e-20; /* pi/2 * 2^-64 */
+
+    if (v.i & 0x80000000) {
+        q = (0 - q) & 3;
+        r = -r;
+    }
+
+    *quadrant = (int32_t)q;
+    return (float)r;
+}
+
+/**
+* @brief Return the Sine and Cosine of f in one range reduction.
+* Uses the same reduction and polynomials as LA_SinCosN, so the array form matches exactly.
+* 
+* @param f Angle in radians
+* @param s Sine (Pointer)
+* @param c Cosine (Pointer)
+* @return void
+**/
+void LibAxis_SinCosF(float f, float* s, float* c) {
+    union {
+        float f;
+        int32_t i;
+    } j, ps, pc, t;
+    float r, r2;
+    int32_t q;
+
+    /* The low bits of (f * 2/pi + 1.5 * 2^23) are the quadrant, two's complement. */
+    j.f = (f * LA_TRIG_2_OVER_PI) + LA_TRIG_ROUND;
+    q = j.i;
+    j.f = j.f - LA_TRIG_ROUND;
+
+    r = (((f - (j.f * LA_TRIG_PIO2_1)) - (j.f * LA_TRIG_PIO2_2)) - (j.f * LA_TRIG_PIO2_3)) - (j.f * LA_TRIG_PIO2_4);
+
+    t.f = f;
+    t.i &= 0x7FFFFFFF;
+    if (t.f > LA_TRIG_REDUCE_MAX)
+        r = LibAxis_TrigReduceLargeF(f, &q);
+    r2 = r * r;
+    ps.f = r + (r * r2 * (LA_SINF_C0 + r2 * (LA_SINF_C1 + r2 * LA_SINF_C2)));
+    pc.f = (1.0f - (0.5f * r2)) + (r2 * r2 * (LA_COSF_C0 + r2 * (LA_COSF_C1 + r2 * LA_COSF_C2)));
+
+    if (q & 1) {
+        t = ps; ps = pc; pc = t;
+    }
+
+    ps.i ^= (q & 2) ? LA_TRIG_SIGN : 0;
+    pc.i ^= ((q + 1) & 2) ? LA_TRIG_SIGN : 0;
+
+    *s = ps.f;
+    *c = pc.f;
+}
+
 /**
 * @brief Return the Sine of f;
 * 
@@ -104,7 +215,10 @@ int32_t LibAxis_Abs(int32_t n) {
 * @return float 
 **/
 float LibAxis_SinF(float f) {
-    return ((float)sin((double)f));
+    float s, c;
+
+    LibAxis_SinCosF(f, &s, &c);
+    return s;
 }
 
 /**
@@ -114,17 +228,182 @@ float LibAxis_SinF(float f) {
 * @return float 
 **/
 float LibAxis_CosF(float f) {
-    return ((float)cos((double)f));
+    float s, c;
+
+    LibAxis_SinCosF(f, &s, &c);
+    return c;
 }
+#endif
 
+/**
+* @brief Store the Sine and Cosine of every element of in.
+* 
+* @param s Sine output array (may be NULL)
+* @param c Cosine output array (may be NULL)
+* @param in Angles in radians
+* @param count Number of elements
+* @return void
+**/
+void LA_KERNEL(LibAxis_SinCosArrayF)(float* s, float* c, float* in, uint32_t count) {
+    LA_F32xN vs, vc;
+    float ts, tc;
+    uint32_t i;
+
+    for (i = 0; i + LA_SIMD_WIDTH <= count; i += LA_SIMD_WIDTH) {
+        LA_SinCosN(LA_LOADN(&in[i]), &vs, &vc);
+        if (s != NULL) LA_STOREN(&s[i], vs);
+        if (c != NULL) LA_STOREN(&c[i], vc);
+    }
+
+    for (; i < count; i++) {
+        LibAxis_SinCosF(in[i], &ts, &tc);
+        if (s != NULL) s[i] = ts;
+        if (c != NULL) c[i] = tc;
+    }
+}
+
+#ifndef LA_DISPATCH_VARIANT
 /**
 * @brief Return the Inverse Cosine of f;
+* Uses the same polynomial as LA_ACosN, so the batch quaternion kernels match exactly.
 * 
-* @param f
-* @return float 
+* @param f Clamped to [-1, 1]
+* @return float Angle in radians, [0, pi]
 **/
 float LibAxis_ArcCosF(float f) {
-    return LibAxis_PowF(LibAxis_CosF((f)), -1);
+    float a, z, s, p, r;
+
+    a = (f < 0.0f) ? -f : f;
+    if (a > 0.5f) {
+        z = 0.5f * (1.0f - a);
+        s = LibAxis_SqrtLevelF(z, LA_SQRT_PRECISE);
+    }
+    else {
+        z = f * f;
+        s = f;
+    }
+
+    p = s + (s * z * (LA_ASINF_C0 + z * (LA_ASINF_C1 + z * (LA_ASINF_C2 + z * (LA_ASINF_C3 + z * LA_ASINF_C4)))));
+    if (a <= 0.5f)
+        return LA_TRIG_PIO2 - p;
+
+    r = p + p;
+    return (f < 0.0f) ? LA_TRIG_PI - r : r;
+}
+
+/*
+ * Square root engine. The scalar entry points use sqrtss/rsqrtss on x64 and
+ * sqrt.s on hard-float MIPS; everything else starts from the bit-trick seed
+ * and refines with Newton steps, the count picked by the LA_SQRT_* level.
+ */
+static inline float LibAxis_RSqrtNewtonF(float n, float y) {
+    return y * (1.5f - (0.5f * n * y * y));
+}
+
+static inline float LibAxis_RSqrtSeedF(float n) {
+    union {
+        float f;
+        uint32_t i;
+    } v;
+
+    v.f = n;
+    v.i = LA_RSQRT_MAGIC - (v.i >> 1);
+    return LibAxis_RSqrtNewtonF(n, v.f);
+}
+
+/**
+* @brief Return the Reciprocal Square Root of n at the given accuracy.
+* 
+* @param n Must be greater than 0
+* @param accuracy LA_SQRT_ESTIMATE, LA_SQRT_FAST or LA_SQRT_PRECISE
+* @return float 
+**/
+float LibAxis_RSqrtLevelF(float n, int32_t accuracy) {
+    float y;
+
+#if LA_SIMD_X86
+    LA_F32x4 v = {n, 0.0f, 0.0f, 0.0f};
+
+    if (accuracy >= LA_SQRT_PRECISE)
+        return 1.0f / __builtin_ia32_sqrtss(v)[0];
+    y = __builtin_ia32_rsqrtss(v)[0];
+    if (accuracy >= LA_SQRT_FAST)
+        y = LibAxis_RSqrtNewtonF(n, y);
+
+    return y;
+#else
+    float scale = 1.0f;
+
+    /* The Newton steps would turn inf into NaN, and the seed is only good for normal floats. */
+    if (n > LA_SQRT_HUGE)
+        return 0.0f;
+
+    if (n < LA_SQRT_TINY) {
+        n = n * LA_SQRT_SCALE;
+        scale = LA_SQRT_RSCALE;
+    }
+
+    y = LibAxis_RSqrtSeedF(n);
+    if (accuracy >= LA_SQRT_PRECISE)
+        y = LibAxis_RSqrtNewtonF(n, y);
+    if (accuracy >= LA_SQRT_FAST)
+        y = LibAxis_RSqrtNewtonF(n, y);
+
+    return y * scale;
+#endif
+}
+
+/* Square root without the hardware instruction; matches the software path of LA_SqrtN. */
+static inline float LibAxis_SqrtSoftF(float n, int32_t accuracy) {
+    float scale = 1.0f;
+    float y, root;
+
+    if (n > LA_SQRT_HUGE)
+        return n;
+
+    if (n < LA_SQRT_TINY) {
+        n = n * LA_SQRT_SCALE;
+        scale = LA_SQRT_SSCALE;
+    }
+
+    y = LibAxis_RSqrtLevelF(n, accuracy);
+    root = n * y;
+
+    /* One residual correction brings the software path to within 1 ULP. */
+    if (accuracy >= LA_SQRT_PRECISE)
+        root = root + (0.5f * y * (n - root * root));
+
+    return root * scale;
+}
+
+/**
+* @brief Return the Square Root of n at the given accuracy.
+* 
+* @param n Values <= 0 return 0
+* @param accuracy LA_SQRT_ESTIMATE, LA_SQRT_FAST or LA_SQRT_PRECISE
+* @return float 
+**/
+float LibAxis_SqrtLevelF(float n, int32_t accuracy) {
+    if (n <= 0.0f)
+        return 0.0f;
+
+#if LA_SIMD_X86
+    if (accuracy >= LA_SQRT_PRECISE) {
+        LA_F32x4 v = {n, 0.0f, 0.0f, 0.0f};
+        return __builtin_ia32_sqrtss(v)[0];
+    }
+
+    return n * LibAxis_RSqrtLevelF(n, accuracy);
+#else
+#if defined(__mips_hard_float)
+    if (accuracy >= LA_SQRT_PRECISE) {
+        float root;
+        __asm__("sqrt.s %0, %1" : "=f"(root) : "f"(n));
+        return root;
+    }
+#endif
+    return LibAxis_SqrtSoftF(n, accuracy);
+#endif
 }
 
 /**
@@ -134,39 +413,54 @@ float LibAxis_ArcCosF(float f) {
 * @return float 
 **/
 float LibAxis_SqrtF(float n) {
-    int s, m, e;
-    s = 0;
-    e = n;
-
-    float sqrt;
- 
-    while (s <= e) {
- 
-        m = (s + e) / 2;
- 
-        if (m * m == n) {
-            sqrt = m;
-            break;
-        }
- 
-        if (m * m < n) {
-            sqrt=s;
-            s = m + 1;
-        }
- 
-        else {
-            e = m - 1;
-        }
-    }
- 
-    float inc = 0.1;
-    for (int i = 0; i < 5; i++) {
-        while (sqrt * sqrt <= n) {
-            sqrt += inc;
-        }
- 
-        sqrt = sqrt - inc;
-        inc = inc / 10;
-    }
-    return sqrt;
+    return LibAxis_SqrtLevelF(n, LA_SQRT_PRECISE);
+}
+
+/**
+* @brief Return the Reciprocal Square Root of n (1 / √n)
+* 
+* @param n
+* @return float 
+**/
+float LibAxis_RSqrtF(float n) {
+    return LibAxis_RSqrtLevelF(n, LA_SQRT_PRECISE);
+}
+#endif
+
+/**
+* @brief Store the Square Root of every element of in to out.
+* 
+* @param out Output array (may be in)
+* @param in Input array
+* @param count Number of elements
+* @param accuracy LA_SQRT_ESTIMATE, LA_SQRT_FAST or LA_SQRT_PRECISE
+* @return void
+**/
+void LA_KERNEL(LibAxis_SqrtArrayF)(float* out, float* in, uint32_t count, int32_t accuracy) {
+    uint32_t i;
+
+    for (i = 0; i + LA_SIMD_WIDTH <= count; i += LA_SIMD_WIDTH)
+        LA_STOREN(&out[i], LA_SqrtN(LA_LOADN(&in[i]), accuracy));
+
+    for (; i < count; i++)
+        out[i] = LibAxis_SqrtLevelF(in[i], accuracy);
+}
+
+/**
+* @brief Store the Reciprocal Square Root of every element of in to out.
+* 
+* @param out Output array (may be in)
+* @param in Input array
+* @param count Number of elements
+* @param accuracy LA_SQRT_ESTIMATE, LA_SQRT_FAST or LA_SQRT_PRECISE
+* @return void
+**/
+void LA_KERNEL(LibAxis_RSqrtArrayF)(float* out, float* in, uint32_t count, int32_t accuracy) {
+    uint32_t i;
+
+    for (i = 0; i + LA_SIMD_WIDTH <= count; i += LA_SIMD_WIDTH)
+        LA_STOREN(&out[i], LA_RSqrtN(LA_LOADN(&in[i]), accuracy));
+
+    for (; i < count; i++)
+        out[i] = LibAxis_RSqrtLevelF(in[i], accuracy);
 }
\ No newline at end of file
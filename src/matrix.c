@@ -7,15 +7,119 @@
 
 #include "../include/libaxis.h"
 
+#ifndef LA_DISPATCH_VARIANT
+/*
+ * Fixed-point conversion. An Mtx44 stores every element as s15.16, with the
+ * sixteen integer halves followed by the sixteen fraction halves. Each element
+ * is converted once (gdSPDefMtx evaluates qs1616 twice) and both halves are
+ * written straight into the destination. The SIMD path splits the halves with
+ * 16-bit lane shuffles, which assumes a little-endian host (LA_SIMD_FIXED).
+ */
+
+static inline void Matrix44_PackFixedF(Mtx44* m, float mf[4][4]) {
+#if LA_SIMD_FIXED
+	const LA_I16x8 int_lanes = {1, 3, 5, 7, 9, 11, 13, 15};
+	const LA_I16x8 frac_lanes = {0, 2, 4, 6, 8, 10, 12, 14};
+	LA_I16x8 qa, qb;
+	int32_t i;
+
+	for (i = 0; i < 4; i += 2)
+	{
+		qa = (LA_I16x8)__builtin_convertvector(LA_LOAD4(mf[i]) * 65536.0f, LA_I32x4);
+		qb = (LA_I16x8)__builtin_convertvector(LA_LOAD4(mf[i + 1]) * 65536.0f, LA_I32x4);
+		*(LA_I16x8u*)&m->i[i * 4] = __builtin_shuffle(qa, qb, int_lanes);
+		*(LA_I16x8u*)&m->f[i * 4] = __builtin_shuffle(qa, qb, frac_lanes);
+	}
+#else
+	qs1616_t q;
+	int32_t i, j;
+
+	for (i = 0; i < 4; i++)
+	{
+		for (j = 0; j < 4; j++)
+		{
+			q = qs1616(mf[i][j]);
+			m->i[(i * 4) + j] = (int16_t)(q >> 16);
+			m->f[(i * 4) + j] = (uint16_t)q;
+		}
+	}
+#endif
+}
+
+static inline void Matrix44_UnpackFixedF(float mf[4][4], Mtx44* m) {
+#if LA_SIMD_FIXED
+	const LA_I16x8 lo_lanes = {0, 8, 1, 9, 2, 10, 3, 11};
+	const LA_I16x8 hi_lanes = {4, 12, 5, 13, 6, 14, 7, 15};
+	LA_I16x8 ih, fh;
+	int32_t i;
+
+	for (i = 0; i < 4; i += 2)
+	{
+		ih = *(const LA_I16x8u*)&m->i[i * 4];
+		fh = *(const LA_I16x8u*)&m->f[i * 4];
+		LA_STORE4(mf[i], __builtin_convertvector((LA_I32x4)__builtin_shuffle(fh, ih, lo_lanes), LA_F32x4) * (1.0f / 65536.0f));
+		LA_STORE4(mf[i + 1], __builtin_convertvector((LA_I32x4)__builtin_shuffle(fh, ih, hi_lanes), LA_F32x4) * (1.0f / 65536.0f));
+	}
+#else
+	qs1616_t q;
+	int32_t i, j;
+
+	for (i = 0; i < 4; i++)
+	{
+		for (j = 0; j < 4; j++)
+		{
+			q = (qs1616_t)(((uint32_t)(uint16_t)m->i[(i * 4) + j] << 16) | m->f[(i * 4) + j]);
+			mf[i][j] = (float)q * (1.0f / 65536.0f);
+		}
+	}
+#endif
+}
+
 void LibAxis_Matrix44ToFixed44(Mtx44* m, float mf[4][4]) {
-    Mtx44 matrix = gdSPDefMtx(
-        mf[0][0], mf[0][1], mf[0][2], mf[0][3],
-        mf[1][0], mf[1][1], mf[1][2], mf[1][3],
-        mf[2][0], mf[2][1], mf[2][2], mf[2][3],
-        mf[3][0], mf[3][1], mf[3][2], mf[3][3]
-    );
+	Matrix44_PackFixedF(m, mf);
+}
+
+/**
+* @brief Convert an array of float matrices to fixed-point. Results match
+* LibAxis_Matrix44ToFixed44 (and gdSPDefMtx) exactly.
+* @param m Array of output fixed-point matrices
+* @param mf Array of float matrices
+* @param count Number of matrices in each array
+* @return void
+**/
+void LibAxis_Matrix44ToFixed44Array(Mtx44* m, float mf[][4][4], uint32_t count) {
+	uint32_t n;
+
+	for (n = 0; n < count; n++)
+	{
+		Matrix44_PackFixedF(&m[n], mf[n]);
+	}
+}
+
+/**
+* @brief Convert a fixed-point matrix back to floats.
+* @param mf The output float matrix
+* @param m The fixed-point matrix
+* @return void
+**/
+void LibAxis_Fixed44ToMatrix44(float mf[4][4], Mtx44* m) {
+	Matrix44_UnpackFixedF(mf, m);
+}
+
+/**
+* @brief Convert an array of fixed-point matrices back to floats.
+* @param mf Array of output float matrices
+* @param m Array of fixed-point matrices
+* @param count Number of matrices in each array
+* @return void
+**/
+void LibAxis_Fixed44ToMatrix44Array(float mf[][4][4], Mtx44* m, uint32_t count) {
+	uint32_t n;
 
-    *m = matrix;
+	for (n = 0; n < count; n++)
+	{
+		Matrix44_UnpackFixedF(mf[n], &m[n]);
+	}
 }
 
 void LibAxis_Matrix44_IdentityF(float mf[4][4]) {
@@ -53,12 +157,9 @@ void LibAxis_Matrix44_RotateF(float mf[4][4], float roll, float pitch, float hea
 	roll *= dtor;
 	pitch *= dtor;
 	heading *= dtor;
-	sinr = sinf(roll);
-	cosr = cosf(roll);
-	sinp = sinf(pitch);
-	cosp = cosf(pitch);
-	sinh = sinf(heading);
-	cosh = cosf(heading);
+	LibAxis_SinCosF(roll, &sinr, &cosr);
+	LibAxis_SinCosF(pitch, &sinp, &cosp);
+	LibAxis_SinCosF(heading, &sinh, &cosh);
 
 	LibAxis_Matrix44_IdentityF(mf);
 
@@ -75,6 +176,97 @@ void LibAxis_Matrix44_RotateF(float mf[4][4], float roll, float pitch, float hea
 	mf[2][2] = cosr * cosp;
 }
 
+/*
+ * Camera matrices, in the row-vector convention (clip = v * view * projection).
+ * The view looks down -z with +y up, and both projections map the visible
+ * depth range to -w <= z <= w, the range LibAxis_Frustum_FromMatrix44F expects.
+ */
+
+/**
+* @brief Build a perspective projection.
+* @param mf The output matrix
+* @param fov_y Vertical field of view in degrees
+* @param aspect Width over height of the viewport
+* @param near Distance to the near plane, greater than 0
+* @param far Distance to the far plane
+* @return void
+**/
+void LibAxis_Matrix44_PerspectiveF(float mf[4][4], float fov_y, float aspect, float near, float far) {
+	static float dtor = 3.1415926f / 180.0f;
+	float sina, cosa, f, depth;
+
+	LibAxis_SinCosF(fov_y * dtor * 0.5f, &sina, &cosa);
+	f = cosa / sina;
+	depth = 1.0f / (near - far);
+
+	LibAxis_Matrix44_IdentityF(mf);
+	mf[0][0] = f / aspect;
+	mf[1][1] = f;
+	mf[2][2] = (far + near) * depth;
+	mf[2][3] = -1.0f;
+	mf[3][2] = 2.0f * far * near * depth;
+	mf[3][3] = 0.0f;
+}
+
+/**
+* @brief Build an orthographic projection of the box [left, right] x [bottom, top] x [-near, -far].
+* @param mf The output matrix
+* @param left Left edge of the view volume
+* @param right Right edge of the view volume
+* @param bottom Bottom edge of the view volume
+* @param top Top edge of the view volume
+* @param near Distance to the near plane
+* @param far Distance to the far plane
+* @return void
+**/
+void LibAxis_Matrix44_OrthographicF(float mf[4][4], float left, float right, float bottom, float top, float near, float far) {
+	float width = 1.0f / (right - left);
+	float height = 1.0f / (top - bottom);
+	float depth = 1.0f / (far - near);
+
+	LibAxis_Matrix44_IdentityF(mf);
+	mf[0][0] = 2.0f * width;
+	mf[1][1] = 2.0f * height;
+	mf[2][2] = -2.0f * depth;
+	mf[3][0] = -(right + left) * width;
+	mf[3][1] = -(top + bottom) * height;
+	mf[3][2] = -(far + near) * depth;
+}
+
+/**
+* @brief Build a view matrix for an eye looking at a target.
+* @param mf The output matrix
+* @param eye Position of the eye
+* @param target Point to look at, not equal to eye
+* @param up Approximate up direction, not parallel to target - eye
+* @return void
+**/
+void LibAxis_Matrix44_LookAtF(float mf[4][4], Vec3f* eye, Vec3f* target, Vec3f* up) {
+	Vec3f forward = Vec3f_Normalize(Vec3f_Sub(*target, *eye));
+	Vec3f right = Vec3f_Cross(&forward, up);
+	Vec3f upward;
+
+	right = Vec3f_Normalize(right);
+	upward = Vec3f_Cross(&right, &forward);
+
+	mf[0][0] = right.x;
+	mf[0][1] = upward.x;
+	mf[0][2] = -forward.x;
+	mf[0][3] = 0.0f;
+	mf[1][0] = right.y;
+	mf[1][1] = upward.y;
+	mf[1][2] = -forward.y;
+	mf[1][3] = 0.0f;
+	mf[2][0] = right.z;
+	mf[2][1] = upward.z;
+	mf[2][2] = -forward.z;
+	mf[2][3] = 0.0f;
+	mf[3][0] = -Vec3f_Dot(&right, eye);
+	mf[3][1] = -Vec3f_Dot(&upward, eye);
+	mf[3][2] = Vec3f_Dot(&forward, eye);
+	mf[3][3] = 1.0f;
+}
+
 void LibAxis_Matrix44_MultiplyF(float mf_a[4][4], float mf_b[4][4], float mf[4][4]) {
 	float rx, ry, rz, rw;
 	float cx, cy, cz, cw;
@@ -198,4 +390,1282 @@ void LibAxis_Matrix44_MultiplyF(float mf_a[4][4], float mf_b[4][4], float mf[4][
 	rz = mf_a[3][2];
 	rw = mf_a[3][3];
 	mf[3][3] = (cx * rx) + (cy * ry) + (cz * rz) + (cw * rw);
-}
\ No newline at end of file
+}
+#endif
+
+/*
+ * Batched multiply. Every kernel below evaluates each output element as
+ * (b[0][j] * a[i][0]) + (b[1][j] * a[i][1]) + (b[2][j] * a[i][2]) + (b[3][j] * a[i][3]),
+ * summed left to right exactly like LibAxis_Matrix44_MultiplyF, so the SIMD
+ * and scalar paths agree bit for bit as long as the compiler is not allowed
+ * to contract the multiply-adds into FMAs (the Makefile passes -ffp-contract=off).
+ * The rows of mf_b are read before anything is written, so the output may
+ * alias either input. dispatch_avx2.c builds these three, and the vertex
+ * stream kernels after them, again with the 8-lane AVX2 rows.
+ */
+typedef struct {
+#if (LA_SIMD == LA_SIMD_AVX2)
+	LA_F32x8 r[4];
+#elif (LA_SIMD != LA_SIMD_SCALAR)
+	LA_F32x4 r[4];
+#else
+	float r[4][4];
+#endif
+} Matrix44RowsF;
+
+static inline void Matrix44_LoadRowsF(Matrix44RowsF* rows, float mf_b[4][4]) {
+#if (LA_SIMD == LA_SIMD_AVX2)
+	const LA_I32x8 lo = {0, 1, 2, 3, 0, 1, 2, 3};
+	const LA_I32x8 hi = {4, 5, 6, 7, 4, 5, 6, 7};
+	LA_F32x8 b01 = LA_LOAD8(mf_b[0]);
+	LA_F32x8 b23 = LA_LOAD8(mf_b[2]);
+
+	rows->r[0] = __builtin_shuffle(b01, lo);
+	rows->r[1] = __builtin_shuffle(b01, hi);
+	rows->r[2] = __builtin_shuffle(b23, lo);
+	rows->r[3] = __builtin_shuffle(b23, hi);
+#elif (LA_SIMD != LA_SIMD_SCALAR)
+	rows->r[0] = LA_LOAD4(mf_b[0]);
+	rows->r[1] = LA_LOAD4(mf_b[1]);
+	rows->r[2] = LA_LOAD4(mf_b[2]);
+	rows->r[3] = LA_LOAD4(mf_b[3]);
+#else
+	int32_t i, j;
+
+	for (i = 0; i < 4; i++)
+	{
+		for (j = 0; j < 4; j++)
+		{
+			rows->r[i][j] = mf_b[i][j];
+		}
+	}
+#endif
+}
+
+static inline void Matrix44_MultiplyRowsF(float mf_a[4][4], const Matrix44RowsF* rows, float mf[4][4]) {
+#if (LA_SIMD == LA_SIMD_AVX2)
+	/* Two output rows per register: lanes 0-3 hold row i, lanes 4-7 row i + 1. */
+	const LA_I32x8 sx = {0, 0, 0, 0, 4, 4, 4, 4};
+	const LA_I32x8 sy = {1, 1, 1, 1, 5, 5, 5, 5};
+	const LA_I32x8 sz = {2, 2, 2, 2, 6, 6, 6, 6};
+	const LA_I32x8 sw = {3, 3, 3, 3, 7, 7, 7, 7};
+	LA_F32x8 r;
+	int32_t i;
+
+	for (i = 0; i < 4; i += 2)
+	{
+		r = LA_LOAD8(mf_a[i]);
+		LA_STORE8(mf[i],
+			  (rows->r[0] * __builtin_shuffle(r, sx))
+			+ (rows->r[1] * __builtin_shuffle(r, sy))
+			+ (rows->r[2] * __builtin_shuffle(r, sz))
+			+ (rows->r[3] * __builtin_shuffle(r, sw)));
+	}
+#elif (LA_SIMD != LA_SIMD_SCALAR)
+	LA_F32x4 r;
+	int32_t i;
+
+	for (i = 0; i < 4; i++)
+	{
+		r = LA_LOAD4(mf_a[i]);
+		LA_STORE4(mf[i],
+			  (rows->r[0] * r[0])
+			+ (rows->r[1] * r[1])
+			+ (rows->r[2] * r[2])
+			+ (rows->r[3] * r[3]));
+	}
+#else
+	float rx, ry, rz, rw;
+	int32_t i, j;
+
+	for (i = 0; i < 4; i++)
+	{
+		rx = mf_a[i][0];
+		ry = mf_a[i][1];
+		rz = mf_a[i][2];
+		rw = mf_a[i][3];
+
+		for (j = 0; j < 4; j++)
+		{
+			mf[i][j] = (rows->r[0][j] * rx) + (rows->r[1][j] * ry) + (rows->r[2][j] * rz) + (rows->r[3][j] * rw);
+		}
+	}
+#endif
+}
+
+/**
+* @brief Multiply count pairs of matrices (mf[n] = mf_a[n] * mf_b[n]).
+* Results match LibAxis_Matrix44_MultiplyF bit for bit.
+* @param mf_a Array of left hand side matrices
+* @param mf_b Array of right hand side matrices
+* @param mf Array of output matrices (may alias mf_a or mf_b)
+* @param count Number of matrices in each array
+* @return void
+**/
+void LA_KERNEL(LibAxis_Matrix44_MultiplyArrayF)(float mf_a[][4][4], float mf_b[][4][4], float mf[][4][4], uint32_t count) {
+	Matrix44RowsF rows;
+	uint32_t n;
+
+	for (n = 0; n < count; n++)
+	{
+		Matrix44_LoadRowsF(&rows, mf_b[n]);
+		Matrix44_MultiplyRowsF(mf_a[n], &rows, mf[n]);
+	}
+}
+
+/**
+* @brief Multiply one matrix by an array of matrices (mf[n] = mf_a * mf_b[n]).
+* Results match LibAxis_Matrix44_MultiplyF bit for bit.
+* @param mf_a Shared left hand side matrix
+* @param mf_b Array of right hand side matrices
+* @param mf Array of output matrices (may alias mf_b)
+* @param count Number of matrices in mf_b and mf
+* @return void
+**/
+void LA_KERNEL(LibAxis_Matrix44_PreMultiplyArrayF)(float mf_a[4][4], float mf_b[][4][4], float mf[][4][4], uint32_t count) {
+	Matrix44RowsF rows;
+	float a[4][4];
+	int32_t i, j;
+	uint32_t n;
+
+	/* Copy the shared matrix so writing mf can never clobber it mid-batch. */
+	for (i = 0; i < 4; i++)
+	{
+		for (j = 0; j < 4; j++)
+		{
+			a[i][j] = mf_a[i][j];
+		}
+	}
+
+	for (n = 0; n < count; n++)
+	{
+		Matrix44_LoadRowsF(&rows, mf_b[n]);
+		Matrix44_MultiplyRowsF(a, &rows, mf[n]);
+	}
+}
+
+/**
+* @brief Multiply an array of matrices by one matrix (mf[n] = mf_a[n] * mf_b).
+* This is the parent concatenation order for the row-vector convention used by
+* LibAxis_Matrix44_TranslateF. Results match LibAxis_Matrix44_MultiplyF bit for bit.
+* @param mf_a Array of left hand side matrices
+* @param mf_b Shared right hand side matrix
+* @param mf Array of output matrices (may alias mf_a)
+* @param count Number of matrices in mf_a and mf
+* @return void
+**/
+void LA_KERNEL(LibAxis_Matrix44_PostMultiplyArrayF)(float mf_a[][4][4], float mf_b[4][4], float mf[][4][4], uint32_t count) {
+	Matrix44RowsF rows;
+	uint32_t n;
+
+	/* mf_b is only read here, so it stays in registers for the whole batch. */
+	Matrix44_LoadRowsF(&rows, mf_b);
+
+	for (n = 0; n < count; n++)
+	{
+		Matrix44_MultiplyRowsF(mf_a[n], &rows, mf[n]);
+	}
+}
+
+/*
+ * Vertex streams. Each kernel broadcasts the matrix elements it needs once and
+ * then transforms LA_SIMD_WIDTH vertices per iteration, running over the
+ * stream padding like the stream.c kernels. Every component is evaluated as
+ * (mf[0][j] * x) + (mf[1][j] * y) + (mf[2][j] * z) + mf[3][j] (without the
+ * last term for directions, with mf[3][j] * w for Vec4f), so the results match
+ * LibAxis_Matrix44_TransformPointF and its siblings bit for bit. The output
+ * may alias the input.
+ */
+typedef struct {
+	LA_F32xN m[4][4];
+} Matrix44SplatF;
+
+static inline void Matrix44_SplatF(Matrix44SplatF* splat, float mf[4][4]) {
+	const LA_F32xN zero = {0.0f};
+	int32_t i, j;
+
+	/* Subtracting zero broadcasts without touching the value, signed zeros included. */
+	for (i = 0; i < 4; i++)
+	{
+		for (j = 0; j < 4; j++)
+		{
+			splat->m[i][j] = mf[i][j] - zero;
+		}
+	}
+}
+
+/**
+* @brief Transform a stream of points (w = 1) by a 4x4 matrix.
+* @param mf The transform
+* @param out Transformed points (may alias in)
+* @param in Points to transform
+* @return void
+**/
+void LA_KERNEL(LibAxis_Matrix44_TransformPointStreamF)(float mf[4][4], Vec3fStream* out, Vec3fStream* in) {
+	Matrix44SplatF s;
+	LA_F32xN x, y, z;
+	uint32_t n;
+
+	Matrix44_SplatF(&s, mf);
+
+	for (n = 0; n < in->count; n += LA_SIMD_WIDTH)
+	{
+		x = LA_LOADN(&in->x[n]);
+		y = LA_LOADN(&in->y[n]);
+		z = LA_LOADN(&in->z[n]);
+		LA_STOREN(&out->x[n], (s.m[0][0] * x) + (s.m[1][0] * y) + (s.m[2][0] * z) + s.m[3][0]);
+		LA_STOREN(&out->y[n], (s.m[0][1] * x) + (s.m[1][1] * y) + (s.m[2][1] * z) + s.m[3][1]);
+		LA_STOREN(&out->z[n], (s.m[0][2] * x) + (s.m[1][2] * y) + (s.m[2][2] * z) + s.m[3][2]);
+	}
+}
+
+/**
+* @brief Transform a stream of directions (w = 0) by a 4x4 matrix, ignoring its translation.
+* @param mf The transform
+* @param out Transformed directions (may alias in)
+* @param in Directions to transform
+* @return void
+**/
+void LA_KERNEL(LibAxis_Matrix44_TransformVectorStreamF)(float mf[4][4], Vec3fStream* out, Vec3fStream* in) {
+	Matrix44SplatF s;
+	LA_F32xN x, y, z;
+	uint32_t n;
+
+	Matrix44_SplatF(&s, mf);
+
+	for (n = 0; n < in->count; n += LA_SIMD_WIDTH)
+	{
+		x = LA_LOADN(&in->x[n]);
+		y = LA_LOADN(&in->y[n]);
+		z = LA_LOADN(&in->z[n]);
+		LA_STOREN(&out->x[n], (s.m[0][0] * x) + (s.m[1][0] * y) + (s.m[2][0] * z));
+		LA_STOREN(&out->y[n], (s.m[0][1] * x) + (s.m[1][1] * y) + (s.m[2][1] * z));
+		LA_STOREN(&out->z[n], (s.m[0][2] * x) + (s.m[1][2] * y) + (s.m[2][2] * z));
+	}
+}
+
+/**
+* @brief Transform a stream of homogeneous vectors by a 4x4 matrix.
+* @param mf The transform
+* @param out Transformed vectors (may alias in)
+* @param in Vectors to transform
+* @return void
+**/
+void LA_KERNEL(LibAxis_Matrix44_TransformVec4StreamF)(float mf[4][4], Vec4fStream* out, Vec4fStream* in) {
+	Matrix44SplatF s;
+	LA_F32xN x, y, z, w;
+	uint32_t n;
+
+	Matrix44_SplatF(&s, mf);
+
+	for (n = 0; n < in->count; n += LA_SIMD_WIDTH)
+	{
+		x = LA_LOADN(&in->x[n]);
+		y = LA_LOADN(&in->y[n]);
+		z = LA_LOADN(&in->z[n]);
+		w = LA_LOADN(&in->w[n]);
+		LA_STOREN(&out->x[n], (s.m[0][0] * x) + (s.m[1][0] * y) + (s.m[2][0] * z) + (s.m[3][0] * w));
+		LA_STOREN(&out->y[n], (s.m[0][1] * x) + (s.m[1][1] * y) + (s.m[2][1] * z) + (s.m[3][1] * w));
+		LA_STOREN(&out->z[n], (s.m[0][2] * x) + (s.m[1][2] * y) + (s.m[2][2] * z) + (s.m[3][2] * w));
+		LA_STOREN(&out->w[n], (s.m[0][3] * x) + (s.m[1][3] * y) + (s.m[2][3] * z) + (s.m[3][3] * w));
+	}
+}
+
+/**
+* @brief Project a stream of points (w = 1) by a 4x4 matrix and divide by the resulting w.
+* Points with a resulting w of 0 come out infinite or NaN.
+* @param mf The projection, e.g. a combined view-projection matrix
+* @param out Projected points (may alias in)
+* @param in Points to project
+* @return void
+**/
+void LA_KERNEL(LibAxis_Matrix44_ProjectPointStreamF)(float mf[4][4], Vec3fStream* out, Vec3fStream* in) {
+	Matrix44SplatF s;
+	LA_F32xN x, y, z, inverse;
+	uint32_t n;
+
+	Matrix44_SplatF(&s, mf);
+
+	for (n = 0; n < in->count; n += LA_SIMD_WIDTH)
+	{
+		x = LA_LOADN(&in->x[n]);
+		y = LA_LOADN(&in->y[n]);
+		z = LA_LOADN(&in->z[n]);
+		inverse = 1.0f / ((s.m[0][3] * x) + (s.m[1][3] * y) + (s.m[2][3] * z) + s.m[3][3]);
+		LA_STOREN(&out->x[n], ((s.m[0][0] * x) + (s.m[1][0] * y) + (s.m[2][0] * z) + s.m[3][0]) * inverse);
+		LA_STOREN(&out->y[n], ((s.m[0][1] * x) + (s.m[1][1] * y) + (s.m[2][1] * z) + s.m[3][1]) * inverse);
+		LA_STOREN(&out->z[n], ((s.m[0][2] * x) + (s.m[1][2] * y) + (s.m[2][2] * z) + s.m[3][2]) * inverse);
+	}
+}
+
+#ifndef LA_DISPATCH_VARIANT
+#if (LA_SIMD != LA_SIMD_SCALAR)
+/* Transpose four rows in registers. */
+static inline void Matrix44_TransposeRowsF(LA_F32x4 r[4]) {
+	LA_TRANSPOSE4(r[0], r[1], r[2], r[3]);
+}
+
+/* 2x2 matrices packed as {xx, xy, yx, yy}: a * b, adj(a) * b and a * adj(b). */
+static inline LA_F32x4 Matrix22_MultiplyF(LA_F32x4 a, LA_F32x4 b) {
+	return (a * LA_SWIZZLE4(b, 0, 3, 0, 3)) + (LA_SWIZZLE4(a, 1, 0, 3, 2) * LA_SWIZZLE4(b, 2, 1, 2, 1));
+}
+
+static inline LA_F32x4 Matrix22_AdjMultiplyF(LA_F32x4 a, LA_F32x4 b) {
+	return (LA_SWIZZLE4(a, 3, 3, 0, 0) * b) - (LA_SWIZZLE4(a, 1, 1, 2, 2) * LA_SWIZZLE4(b, 2, 3, 0, 1));
+}
+
+static inline LA_F32x4 Matrix22_MultiplyAdjF(LA_F32x4 a, LA_F32x4 b) {
+	return (a * LA_SWIZZLE4(b, 3, 0, 3, 0)) - (LA_SWIZZLE4(a, 1, 0, 3, 2) * LA_SWIZZLE4(b, 2, 1, 2, 1));
+}
+
+static inline LA_F32x4 Matrix44_Cross3F(LA_F32x4 a, LA_F32x4 b) {
+	return (LA_SWIZZLE4(a, 1, 2, 0, 3) * LA_SWIZZLE4(b, 2, 0, 1, 3)) - (LA_SWIZZLE4(a, 2, 0, 1, 3) * LA_SWIZZLE4(b, 1, 2, 0, 3));
+}
+#endif
+
+/**
+* @brief Transpose a matrix in place.
+* @param mf The matrix to transpose
+* @return void
+**/
+void LibAxis_Matrix44_TransposeF(float mf[4][4]) {
+#if (LA_SIMD != LA_SIMD_SCALAR)
+	LA_F32x4 r[4];
+
+	r[0] = LA_LOAD4(mf[0]);
+	r[1] = LA_LOAD4(mf[1]);
+	r[2] = LA_LOAD4(mf[2]);
+	r[3] = LA_LOAD4(mf[3]);
+	Matrix44_TransposeRowsF(r);
+	LA_STORE4(mf[0], r[0]);
+	LA_STORE4(mf[1], r[1]);
+	LA_STORE4(mf[2], r[2]);
+	LA_STORE4(mf[3], r[3]);
+#else
+	float t;
+	int32_t i, j;
+
+	for (i = 0; i < 4; i++)
+	{
+		for (j = i + 1; j < 4; j++)
+		{
+			t = mf[i][j];
+			mf[i][j] = mf[j][i];
+			mf[j][i] = t;
+		}
+	}
+#endif
+}
+
+/**
+* @brief Transpose an array of matrices in place.
+* @param mf Array of matrices to transpose
+* @param count Number of matrices in mf
+* @return void
+**/
+void LibAxis_Matrix44_TransposeArrayF(float mf[][4][4], uint32_t count) {
+	uint32_t n;
+
+	for (n = 0; n < count; n++)
+	{
+		LibAxis_Matrix44_TransposeF(mf[n]);
+	}
+}
+
+/**
+* @brief Invert a general 4x4 matrix.
+* The SIMD path inverts the four 2x2 blocks and combines them (the
+* block-wise adjugate); the scalar path expands by 2x2 cofactors.
+* @param mf_a The matrix to invert
+* @param mf The output matrix (may alias mf_a), left untouched if mf_a is singular
+* @return 1 if mf_a was inverted, 0 if its determinant is zero
+**/
+int32_t LibAxis_Matrix44_InverseF(float mf_a[4][4], float mf[4][4]) {
+#if (LA_SIMD != LA_SIMD_SCALAR)
+	const LA_F32x4 sign = {1.0f, -1.0f, -1.0f, 1.0f};
+	LA_F32x4 r0, r1, r2, r3;
+	LA_F32x4 a, b, c, d, det_sub, det_a, det_b, det_c, det_d;
+	LA_F32x4 ab, dc, x, y, z, w, tr, det;
+
+	r0 = LA_LOAD4(mf_a[0]);
+	r1 = LA_LOAD4(mf_a[1]);
+	r2 = LA_LOAD4(mf_a[2]);
+	r3 = LA_LOAD4(mf_a[3]);
+
+	/* The 2x2 blocks of [A B; C D] and their determinants {|A|, |B|, |C|, |D|}. */
+	a = LA_SHUFFLE4(r0, r1, 0, 1, 0, 1);
+	b = LA_SHUFFLE4(r0, r1, 2, 3, 2, 3);
+	c = LA_SHUFFLE4(r2, r3, 0, 1, 0, 1);
+	d = LA_SHUFFLE4(r2, r3, 2, 3, 2, 3);
+	det_sub = (LA_SHUFFLE4(r0, r2, 0, 2, 0, 2) * LA_SHUFFLE4(r1, r3, 1, 3, 1, 3))
+		- (LA_SHUFFLE4(r0, r2, 1, 3, 1, 3) * LA_SHUFFLE4(r1, r3, 0, 2, 0, 2));
+	det_a = LA_SWIZZLE4(det_sub, 0, 0, 0, 0);
+	det_b = LA_SWIZZLE4(det_sub, 1, 1, 1, 1);
+	det_c = LA_SWIZZLE4(det_sub, 2, 2, 2, 2);
+	det_d = LA_SWIZZLE4(det_sub, 3, 3, 3, 3);
+
+	ab = Matrix22_AdjMultiplyF(a, b);
+	dc = Matrix22_AdjMultiplyF(d, c);
+	x = (det_d * a) - Matrix22_MultiplyF(b, dc);
+	w = (det_a * d) - Matrix22_MultiplyF(c, ab);
+	y = (det_b * c) - Matrix22_MultiplyAdjF(d, ab);
+	z = (det_c * b) - Matrix22_MultiplyAdjF(a, dc);
+
+	/* |M| = |A||D| + |B||C| - tr(adj(A)B adj(D)C) */
+	tr = ab * LA_SWIZZLE4(dc, 0, 2, 1, 3);
+	tr = tr + LA_SWIZZLE4(tr, 2, 3, 0, 1);
+	tr = tr + LA_SWIZZLE4(tr, 1, 0, 3, 2);
+	det = (det_a * det_d) + (det_b * det_c) - tr;
+
+	if (det[0] == 0.0f)
+		return 0;
+
+	det = sign / det;
+	x = x * det;
+	y = y * det;
+	z = z * det;
+	w = w * det;
+
+	LA_STORE4(mf[0], LA_SHUFFLE4(x, y, 3, 1, 3, 1));
+	LA_STORE4(mf[1], LA_SHUFFLE4(x, y, 2, 0, 2, 0));
+	LA_STORE4(mf[2], LA_SHUFFLE4(z, w, 3, 1, 3, 1));
+	LA_STORE4(mf[3], LA_SHUFFLE4(z, w, 2, 0, 2, 0));
+
+	return 1;
+#else
+	float m[4][4];
+	float s0, s1, s2, s3, s4, s5;
+	float c0, c1, c2, c3, c4, c5;
+	float det;
+	int32_t i, j;
+
+	for (i = 0; i < 4; i++)
+	{
+		for (j = 0; j < 4; j++)
+		{
+			m[i][j] = mf_a[i][j];
+		}
+	}
+
+	s0 = m[0][0] * m[1][1] - m[1][0] * m[0][1];
+	s1 = m[0][0] * m[1][2] - m[1][0] * m[0][2];
+	s2 = m[0][0] * m[1][3] - m[1][0] * m[0][3];
+	s3 = m[0][1] * m[1][2] - m[1][1] * m[0][2];
+	s4 = m[0][1] * m[1][3] - m[1][1] * m[0][3];
+	s5 = m[0][2] * m[1][3] - m[1][2] * m[0][3];
+
+	c5 = m[2][2] * m[3][3] - m[3][2] * m[2][3];
+	c4 = m[2][1] * m[3][3] - m[3][1] * m[2][3];
+	c3 = m[2][1] * m[3][2] - m[3][1] * m[2][2];
+	c2 = m[2][0] * m[3][3] - m[3][0] * m[2][3];
+	c1 = m[2][0] * m[3][2] - m[3][0] * m[2][2];
+	c0 = m[2][0] * m[3][1] - m[3][0] * m[2][1];
+
+	det = s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0;
+
+	if (det == 0.0f)
+		return 0;
+
+	det = 1.0f / det;
+
+	mf[0][0] = ( m[1][1] * c5 - m[1][2] * c4 + m[1][3] * c3) * det;
+	mf[0][1] = (-m[0][1] * c5 + m[0][2] * c4 - m[0][3] * c3) * det;
+	mf[0][2] = ( m[3][1] * s5 - m[3][2] * s4 + m[3][3] * s3) * det;
+	mf[0][3] = (-m[2][1] * s5 + m[2][2] * s4 - m[2][3] * s3) * det;
+
+	mf[1][0] = (-m[1][0] * c5 + m[1][2] * c2 - m[1][3] * c1) * det;
+	mf[1][1] = ( m[0][0] * c5 - m[0][2] * c2 + m[0][3] * c1) * det;
+	mf[1][2] = (-m[3][0] * s5 + m[3][2] * s2 - m[3][3] * s1) * det;
+	mf[1][3] = ( m[2][0] * s5 - m[2][2] * s2 + m[2][3] * s1) * det;
+
+	mf[2][0] = ( m[1][0] * c4 - m[1][1] * c2 + m[1][3] * c0) * det;
+	mf[2][1] = (-m[0][0] * c4 + m[0][1] * c2 - m[0][3] * c0) * det;
+	mf[2][2] = ( m[3][0] * s4 - m[3][1] * s2 + m[3][3] * s0) * det;
+	mf[2][3] = (-m[2][0] * s4 + m[2][1] * s2 - m[2][3] * s0) * det;
+
+	mf[3][0] = (-m[1][0] * c3 + m[1][1] * c1 - m[1][2] * c0) * det;
+	mf[3][1] = ( m[0][0] * c3 - m[0][1] * c1 + m[0][2] * c0) * det;
+	mf[3][2] = (-m[3][0] * s3 + m[3][1] * s1 - m[3][2] * s0) * det;
+	mf[3][3] = ( m[2][0] * s3 - m[2][1] * s1 + m[2][2] * s0) * det;
+
+	return 1;
+#endif
+}
+
+/**
+* @brief Invert an array of general 4x4 matrices.
+* @param mf_a Array of matrices to invert
+* @param mf Array of output matrices (may alias mf_a)
+* @param count Number of matrices in each array
+* @return The number of matrices inverted; singular ones are left untouched in mf
+**/
+uint32_t LibAxis_Matrix44_InverseArrayF(float mf_a[][4][4], float mf[][4][4], uint32_t count) {
+	uint32_t n, inverted = 0;
+
+	for (n = 0; n < count; n++)
+	{
+		inverted += LibAxis_Matrix44_InverseF(mf_a[n], mf[n]);
+	}
+
+	return inverted;
+}
+
+/**
+* @brief Invert an affine matrix (3x3 linear part in rows 0-2, translation in row 3,
+* as built by LibAxis_Matrix44_TranslateF/ScaleF/RotateF). The last column is
+* assumed to be (0, 0, 0, 1) and is written as such.
+* @param mf_a The matrix to invert
+* @param mf The output matrix (may alias mf_a), left untouched if mf_a is singular
+* @return 1 if mf_a was inverted, 0 if its 3x3 part is singular
+**/
+int32_t LibAxis_Matrix44_InverseAffineF(float mf_a[4][4], float mf[4][4]) {
+#if (LA_SIMD != LA_SIMD_SCALAR)
+	const LA_F32x4 zero = {0.0f};
+	const LA_F32x4 one_w = {0.0f, 0.0f, 0.0f, 1.0f};
+	LA_F32x4 r[4], r0, r1, r2, t, det;
+
+	r0 = LA_LOAD4(mf_a[0]);
+	r1 = LA_LOAD4(mf_a[1]);
+	r2 = LA_LOAD4(mf_a[2]);
+	t = LA_LOAD4(mf_a[3]);
+
+	/* The columns of the 3x3 inverse are the cross products of its rows over the determinant. */
+	r[0] = Matrix44_Cross3F(r1, r2);
+	det = r0 * r[0];
+	det = LA_SWIZZLE4(det, 0, 0, 0, 0) + LA_SWIZZLE4(det, 1, 1, 1, 1) + LA_SWIZZLE4(det, 2, 2, 2, 2);
+
+	if (det[0] == 0.0f)
+		return 0;
+
+	det = 1.0f / det;
+	r[0] = r[0] * det;
+	r[1] = Matrix44_Cross3F(r2, r0) * det;
+	r[2] = Matrix44_Cross3F(r0, r1) * det;
+	r[3] = zero;
+	Matrix44_TransposeRowsF(r);
+
+	LA_STORE4(mf[0], r[0]);
+	LA_STORE4(mf[1], r[1]);
+	LA_STORE4(mf[2], r[2]);
+	LA_STORE4(mf[3], one_w - ((r[0] * t[0]) + (r[1] * t[1]) + (r[2] * t[2])));
+
+	return 1;
+#else
+	float m[4][3];
+	float det;
+	int32_t i, j;
+
+	for (i = 0; i < 4; i++)
+	{
+		for (j = 0; j < 3; j++)
+		{
+			m[i][j] = mf_a[i][j];
+		}
+	}
+
+	det = m[0][0] * (m[1][1] * m[2][2] - m[1][2] * m[2][1])
+		+ m[0][1] * (m[1][2] * m[2][0] - m[1][0] * m[2][2])
+		+ m[0][2] * (m[1][0] * m[2][1] - m[1][1] * m[2][0]);
+
+	if (det == 0.0f)
+		return 0;
+
+	det = 1.0f / det;
+
+	mf[0][0] = (m[1][1] * m[2][2] - m[1][2] * m[2][1]) * det;
+	mf[0][1] = (m[2][1] * m[0][2] - m[2][2] * m[0][1]) * det;
+	mf[0][2] = (m[0][1] * m[1][2] - m[0][2] * m[1][1]) * det;
+	mf[1][0] = (m[1][2] * m[2][0] - m[1][0] * m[2][2]) * det;
+	mf[1][1] = (m[2][2] * m[0][0] - m[2][0] * m[0][2]) * det;
+	mf[1][2] = (m[0][2] * m[1][0] - m[0][0] * m[1][2]) * det;
+	mf[2][0] = (m[1][0] * m[2][1] - m[1][1] * m[2][0]) * det;
+	mf[2][1] = (m[2][0] * m[0][1] - m[2][1] * m[0][0]) * det;
+	mf[2][2] = (m[0][0] * m[1][1] - m[0][1] * m[1][0]) * det;
+
+	for (j = 0; j < 3; j++)
+	{
+		mf[3][j] = -((m[3][0] * mf[0][j]) + (m[3][1] * mf[1][j]) + (m[3][2] * mf[2][j]));
+	}
+
+	mf[0][3] = 0.0f;
+	mf[1][3] = 0.0f;
+	mf[2][3] = 0.0f;
+	mf[3][3] = 1.0f;
+
+	return 1;
+#endif
+}
+
+/**
+* @brief Invert an array of affine matrices. See LibAxis_Matrix44_InverseAffineF.
+* @param mf_a Array of matrices to invert
+* @param mf Array of output matrices (may alias mf_a)
+* @param count Number of matrices in each array
+* @return The number of matrices inverted; singular ones are left untouched in mf
+**/
+uint32_t LibAxis_Matrix44_InverseAffineArrayF(float mf_a[][4][4], float mf[][4][4], uint32_t count) {
+	uint32_t n, inverted = 0;
+
+	for (n = 0; n < count; n++)
+	{
+		inverted += LibAxis_Matrix44_InverseAffineF(mf_a[n], mf[n]);
+	}
+
+	return inverted;
+}
+
+/**
+* @brief Invert a rigid-body matrix (orthonormal rotation in rows 0-2, translation in row 3).
+* The inverse is the transposed rotation with the translation rotated back and negated,
+* so no determinant or division is needed. Scaled matrices need LibAxis_Matrix44_InverseAffineF.
+* @param mf_a The matrix to invert
+* @param mf The output matrix (may alias mf_a)
+* @return void
+**/
+void LibAxis_Matrix44_InverseRigidF(float mf_a[4][4], float mf[4][4]) {
+#if (LA_SIMD != LA_SIMD_SCALAR)
+	const LA_F32x4 zero = {0.0f};
+	const LA_F32x4 one_w = {0.0f, 0.0f, 0.0f, 1.0f};
+	LA_F32x4 r[4], t;
+
+	r[0] = LA_LOAD4(mf_a[0]);
+	r[1] = LA_LOAD4(mf_a[1]);
+	r[2] = LA_LOAD4(mf_a[2]);
+	t = LA_LOAD4(mf_a[3]);
+	r[3] = zero;
+	Matrix44_TransposeRowsF(r);
+
+	/* Transposing with a zero fourth row also clears the last column. */
+	LA_STORE4(mf[0], r[0]);
+	LA_STORE4(mf[1], r[1]);
+	LA_STORE4(mf[2], r[2]);
+	LA_STORE4(mf[3], one_w - ((r[0] * t[0]) + (r[1] * t[1]) + (r[2] * t[2])));
+#else
+	float m[4][3];
+	int32_t i, j;
+
+	for (i = 0; i < 4; i++)
+	{
+		for (j = 0; j < 3; j++)
+		{
+			m[i][j] = mf_a[i][j];
+		}
+	}
+
+	for (i = 0; i < 3; i++)
+	{
+		for (j = 0; j < 3; j++)
+		{
+			mf[i][j] = m[j][i];
+		}
+
+		mf[i][3] = 0.0f;
+		mf[3][i] = -((m[3][0] * m[i][0]) + (m[3][1] * m[i][1]) + (m[3][2] * m[i][2]));
+	}
+
+	mf[3][3] = 1.0f;
+#endif
+}
+
+/**
+* @brief Invert an array of rigid-body matrices. See LibAxis_Matrix44_InverseRigidF.
+* @param mf_a Array of matrices to invert
+* @param mf Array of output matrices (may alias mf_a)
+* @param count Number of matrices in each array
+* @return void
+**/
+void LibAxis_Matrix44_InverseRigidArrayF(float mf_a[][4][4], float mf[][4][4], uint32_t count) {
+	uint32_t n;
+
+	for (n = 0; n < count; n++)
+	{
+		LibAxis_Matrix44_InverseRigidF(mf_a[n], mf[n]);
+	}
+}
+
+/* How Matrix44_TransformStridedF treats its three-component vertices. */
+#define MATRIX44_VECTOR  0
+#define MATRIX44_POINT   1
+#define MATRIX44_PROJECT 2
+
+/* Transform count vertices of three floats, in_stride and out_stride bytes apart, in the component order of the stream kernels. */
+static void Matrix44_TransformStridedF(float mf[4][4], uint8_t* out, uint32_t out_stride, uint8_t* in, uint32_t in_stride, uint32_t count, int32_t mode) {
+	float* v;
+	float* o;
+	uint32_t n;
+#if (LA_SIMD != LA_SIMD_SCALAR)
+	LA_F32x4 r0 = LA_LOAD4(mf[0]);
+	LA_F32x4 r1 = LA_LOAD4(mf[1]);
+	LA_F32x4 r2 = LA_LOAD4(mf[2]);
+	LA_F32x4 r3 = LA_LOAD4(mf[3]);
+	LA_F32x4 t;
+
+	for (n = 0; n < count; n++)
+	{
+		v = (float*)(in + (n * in_stride));
+		o = (float*)(out + (n * out_stride));
+
+		t = (r0 * v[0]) + (r1 * v[1]) + (r2 * v[2]);
+		if (mode != MATRIX44_VECTOR)
+		{
+			t = t + r3;
+		}
+		if (mode == MATRIX44_PROJECT)
+		{
+			t = t * (1.0f / t[3]);
+		}
+
+		o[0] = t[0];
+		o[1] = t[1];
+		o[2] = t[2];
+	}
+#else
+	float m[4][4];
+	float x, y, z, w;
+	int32_t i, j;
+
+	for (i = 0; i < 4; i++)
+	{
+		for (j = 0; j < 4; j++)
+		{
+			m[i][j] = mf[i][j];
+		}
+	}
+
+	for (n = 0; n < count; n++)
+	{
+		v = (float*)(in + (n * in_stride));
+		o = (float*)(out + (n * out_stride));
+
+		x = (m[0][0] * v[0]) + (m[1][0] * v[1]) + (m[2][0] * v[2]);
+		y = (m[0][1] * v[0]) + (m[1][1] * v[1]) + (m[2][1] * v[2]);
+		z = (m[0][2] * v[0]) + (m[1][2] * v[1]) + (m[2][2] * v[2]);
+		if (mode != MATRIX44_VECTOR)
+		{
+			x += m[3][0];
+			y += m[3][1];
+			z += m[3][2];
+		}
+		if (mode == MATRIX44_PROJECT)
+		{
+			w = 1.0f / ((m[0][3] * v[0]) + (m[1][3] * v[1]) + (m[2][3] * v[2]) + m[3][3]);
+			x *= w;
+			y *= w;
+			z *= w;
+		}
+
+		o[0] = x;
+		o[1] = y;
+		o[2] = z;
+	}
+#endif
+}
+
+/**
+* @brief Transform a point (w = 1) by a 4x4 matrix, without a perspective divide.
+* @param mf The transform
+* @param point The point to transform
+* @return The transformed point
+**/
+Vec3f LibAxis_Matrix44_TransformPointF(float mf[4][4], Vec3f* point) {
+	Vec3f out;
+
+	Matrix44_TransformStridedF(mf, (uint8_t*)&out, sizeof(Vec3f), (uint8_t*)point, sizeof(Vec3f), 1, MATRIX44_POINT);
+	return out;
+}
+
+/**
+* @brief Transform a direction (w = 0) by a 4x4 matrix, ignoring its translation.
+* @param mf The transform
+* @param vector The direction to transform
+* @return The transformed direction
+**/
+Vec3f LibAxis_Matrix44_TransformVectorF(float mf[4][4], Vec3f* vector) {
+	Vec3f out;
+
+	Matrix44_TransformStridedF(mf, (uint8_t*)&out, sizeof(Vec3f), (uint8_t*)vector, sizeof(Vec3f), 1, MATRIX44_VECTOR);
+	return out;
+}
+
+/**
+* @brief Project a point (w = 1) by a 4x4 matrix and divide by the resulting w.
+* A resulting w of 0 gives an infinite or NaN point.
+* @param mf The projection, e.g. a combined view-projection matrix
+* @param point The point to project
+* @return The projected point
+**/
+Vec3f LibAxis_Matrix44_ProjectPointF(float mf[4][4], Vec3f* point) {
+	Vec3f out;
+
+	Matrix44_TransformStridedF(mf, (uint8_t*)&out, sizeof(Vec3f), (uint8_t*)point, sizeof(Vec3f), 1, MATRIX44_PROJECT);
+	return out;
+}
+
+/**
+* @brief Transform a homogeneous vector by a 4x4 matrix.
+* @param mf The transform
+* @param vector The vector to transform
+* @return The transformed vector
+**/
+Vec4f LibAxis_Matrix44_TransformVec4F(float mf[4][4], Vec4f* vector) {
+	Vec4f out;
+
+	LibAxis_Matrix44_TransformVec4ArrayF(mf, &out, vector, 1);
+	return out;
+}
+
+/**
+* @brief Transform an array of points (w = 1) by a 4x4 matrix, without a perspective divide.
+* @param mf The transform
+* @param out Array of transformed points (may alias in)
+* @param in Array of points to transform
+* @param count Number of points
+* @return void
+**/
+void LibAxis_Matrix44_TransformPointArrayF(float mf[4][4], Vec3f* out, Vec3f* in, uint32_t count) {
+	Matrix44_TransformStridedF(mf, (uint8_t*)out, sizeof(Vec3f), (uint8_t*)in, sizeof(Vec3f), count, MATRIX44_POINT);
+}
+
+/**
+* @brief Transform an array of directions (w = 0) by a 4x4 matrix, ignoring its translation.
+* @param mf The transform
+* @param out Array of transformed directions (may alias in)
+* @param in Array of directions to transform
+* @param count Number of directions
+* @return void
+**/
+void LibAxis_Matrix44_TransformVectorArrayF(float mf[4][4], Vec3f* out, Vec3f* in, uint32_t count) {
+	Matrix44_TransformStridedF(mf, (uint8_t*)out, sizeof(Vec3f), (uint8_t*)in, sizeof(Vec3f), count, MATRIX44_VECTOR);
+}
+
+/**
+* @brief Project an array of points (w = 1) by a 4x4 matrix and divide each by its resulting w.
+* @param mf The projection, e.g. a combined view-projection matrix
+* @param out Array of projected points (may alias in)
+* @param in Array of points to project
+* @param count Number of points
+* @return void
+**/
+void LibAxis_Matrix44_ProjectPointArrayF(float mf[4][4], Vec3f* out, Vec3f* in, uint32_t count) {
+	Matrix44_TransformStridedF(mf, (uint8_t*)out, sizeof(Vec3f), (uint8_t*)in, sizeof(Vec3f), count, MATRIX44_PROJECT);
+}
+
+/**
+* @brief Transform an array of homogeneous vectors by a 4x4 matrix.
+* @param mf The transform
+* @param out Array of transformed vectors (may alias in)
+* @param in Array of vectors to transform
+* @param count Number of vectors
+* @return void
+**/
+void LibAxis_Matrix44_TransformVec4ArrayF(float mf[4][4], Vec4f* out, Vec4f* in, uint32_t count) {
+	uint32_t n;
+#if (LA_SIMD != LA_SIMD_SCALAR)
+	LA_F32x4 r0 = LA_LOAD4(mf[0]);
+	LA_F32x4 r1 = LA_LOAD4(mf[1]);
+	LA_F32x4 r2 = LA_LOAD4(mf[2]);
+	LA_F32x4 r3 = LA_LOAD4(mf[3]);
+	LA_F32x4 v;
+
+	for (n = 0; n < count; n++)
+	{
+		v = LA_LOAD4(&in[n]);
+		LA_STORE4(&out[n], (r0 * v[0]) + (r1 * v[1]) + (r2 * v[2]) + (r3 * v[3]));
+	}
+#else
+	float m[4][4];
+	Vec4f v;
+	int32_t i, j;
+
+	for (i = 0; i < 4; i++)
+	{
+		for (j = 0; j < 4; j++)
+		{
+			m[i][j] = mf[i][j];
+		}
+	}
+
+	for (n = 0; n < count; n++)
+	{
+		v = in[n];
+		out[n].x = (m[0][0] * v.x) + (m[1][0] * v.y) + (m[2][0] * v.z) + (m[3][0] * v.w);
+		out[n].y = (m[0][1] * v.x) + (m[1][1] * v.y) + (m[2][1] * v.z) + (m[3][1] * v.w);
+		out[n].z = (m[0][2] * v.x) + (m[1][2] * v.y) + (m[2][2] * v.z) + (m[3][2] * v.w);
+		out[n].w = (m[0][3] * v.x) + (m[1][3] * v.y) + (m[2][3] * v.z) + (m[3][3] * v.w);
+	}
+#endif
+}
+
+/**
+* @brief Transform points (w = 1) in an interleaved vertex buffer by a 4x4 matrix.
+* @param mf The transform
+* @param out First output position; may alias in when the strides match
+* @param out_stride Bytes from one output position to the next
+* @param in First input position, three floats
+* @param in_stride Bytes from one input position to the next, e.g. sizeof the vertex
+* @param count Number of vertices
+* @return void
+**/
+void LibAxis_Matrix44_TransformPointStridedF(float mf[4][4], void* out, uint32_t out_stride, void* in, uint32_t in_stride, uint32_t count) {
+	Matrix44_TransformStridedF(mf, (uint8_t*)out, out_stride, (uint8_t*)in, in_stride, count, MATRIX44_POINT);
+}
+
+/**
+* @brief Transform directions (w = 0), such as normals, in an interleaved vertex buffer by a 4x4 matrix.
+* Normals of a non-uniformly scaled mesh need the inverse transpose of the transform.
+* @param mf The transform
+* @param out First output direction; may alias in when the strides match
+* @param out_stride Bytes from one output direction to the next
+* @param in First input direction, three floats
+* @param in_stride Bytes from one input direction to the next
+* @param count Number of vertices
+* @return void
+**/
+void LibAxis_Matrix44_TransformVectorStridedF(float mf[4][4], void* out, uint32_t out_stride, void* in, uint32_t in_stride, uint32_t count) {
+	Matrix44_TransformStridedF(mf, (uint8_t*)out, out_stride, (uint8_t*)in, in_stride, count, MATRIX44_VECTOR);
+}
+
+/**
+* @brief Project points (w = 1) in an interleaved vertex buffer by a 4x4 matrix and divide each by its resulting w.
+* @param mf The projection, e.g. a combined view-projection matrix
+* @param out First output position; may alias in when the strides match
+* @param out_stride Bytes from one output position to the next
+* @param in First input position, three floats
+* @param in_stride Bytes from one input position to the next
+* @param count Number of vertices
+* @return void
+**/
+void LibAxis_Matrix44_ProjectPointStridedF(float mf[4][4], void* out, uint32_t out_stride, void* in, uint32_t in_stride, uint32_t count) {
+	Matrix44_TransformStridedF(mf, (uint8_t*)out, out_stride, (uint8_t*)in, in_stride, count, MATRIX44_PROJECT);
+}
+
+/*
+ * 4x3 affine matrices. These behave like a Matrix44 whose last column is
+ * (0, 0, 0, 1), so a product only needs 36 multiplies instead of 64 and each
+ * matrix is 48 bytes instead of 64. The twelve floats are contiguous, so the
+ * SIMD kernels move a matrix as three four-lane vectors.
+ */
+#if (LA_SIMD != LA_SIMD_SCALAR)
+typedef struct {
+	LA_F32x4 r0, r1, r2, r3;
+} Matrix43RowsF;
+
+/* Unpack 12 contiguous floats into four rows of {x, y, z, _}. */
+static inline void Matrix43_LoadRowsF(Matrix43RowsF* rows, float mf[4][3]) {
+	LA_F32x4 v0 = LA_LOAD4(&mf[0][0]);
+	LA_F32x4 v1 = LA_LOAD4(&mf[1][1]);
+	LA_F32x4 v2 = LA_LOAD4(&mf[2][2]);
+
+	rows->r0 = v0;
+	rows->r1 = __builtin_shuffle(v0, v1, (LA_I32x4){3, 4, 5, 5});
+	rows->r2 = LA_SHUFFLE4(v1, v2, 2, 3, 0, 0);
+	rows->r3 = LA_SWIZZLE4(v2, 1, 2, 3, 3);
+}
+
+/* mf = mf_a * rows, packing the result back into 12 contiguous floats. mf_a is fully read before mf is written. */
+static inline void Matrix43_MultiplyRowsF(float mf_a[4][3], const Matrix43RowsF* rows, float mf[4][3]) {
+	LA_F32x4 r0 = (rows->r0 * mf_a[0][0]) + (rows->r1 * mf_a[0][1]) + (rows->r2 * mf_a[0][2]);
+	LA_F32x4 r1 = (rows->r0 * mf_a[1][0]) + (rows->r1 * mf_a[1][1]) + (rows->r2 * mf_a[1][2]);
+	LA_F32x4 r2 = (rows->r0 * mf_a[2][0]) + (rows->r1 * mf_a[2][1]) + (rows->r2 * mf_a[2][2]);
+	LA_F32x4 r3 = (rows->r0 * mf_a[3][0]) + (rows->r1 * mf_a[3][1]) + (rows->r2 * mf_a[3][2]) + rows->r3;
+
+	LA_STORE4(&mf[0][0], __builtin_shuffle(r0, r1, (LA_I32x4){0, 1, 2, 4}));
+	LA_STORE4(&mf[1][1], LA_SHUFFLE4(r1, r2, 1, 2, 0, 1));
+	LA_STORE4(&mf[2][2], __builtin_shuffle(r2, r3, (LA_I32x4){2, 4, 5, 6}));
+}
+#endif
+
+/**
+* @brief Set a 4x3 matrix to identity.
+* @param mf The matrix to set
+* @return void
+**/
+void LibAxis_Matrix43_IdentityF(float mf[4][3]) {
+	int32_t i, j;
+
+	for (i = 0; i < 4; i++)
+	{
+		for (j = 0; j < 3; j++)
+		{
+			mf[i][j] = (i == j) ? 1.0f : 0.0f;
+		}
+	}
+}
+
+/**
+* @brief Multiply two 4x3 affine matrices (mf = mf_a * mf_b, as if both were Matrix44).
+* @param mf_a Left hand side matrix
+* @param mf_b Right hand side matrix
+* @param mf The output matrix (may alias mf_a or mf_b)
+* @return void
+**/
+void LibAxis_Matrix43_MultiplyF(float mf_a[4][3], float mf_b[4][3], float mf[4][3]) {
+#if (LA_SIMD != LA_SIMD_SCALAR)
+	Matrix43RowsF rows;
+
+	Matrix43_LoadRowsF(&rows, mf_b);
+	Matrix43_MultiplyRowsF(mf_a, &rows, mf);
+#else
+	float a[4][3], b[4][3];
+	int32_t i, j;
+
+	for (i = 0; i < 4; i++)
+	{
+		for (j = 0; j < 3; j++)
+		{
+			a[i][j] = mf_a[i][j];
+			b[i][j] = mf_b[i][j];
+		}
+	}
+
+	for (i = 0; i < 4; i++)
+	{
+		for (j = 0; j < 3; j++)
+		{
+			mf[i][j] = (b[0][j] * a[i][0]) + (b[1][j] * a[i][1]) + (b[2][j] * a[i][2]);
+		}
+	}
+
+	for (j = 0; j < 3; j++)
+	{
+		mf[3][j] = mf[3][j] + b[3][j];
+	}
+#endif
+}
+
+/**
+* @brief Multiply count pairs of 4x3 matrices (mf[n] = mf_a[n] * mf_b[n]).
+* @param mf_a Array of left hand side matrices
+* @param mf_b Array of right hand side matrices
+* @param mf Array of output matrices (may alias mf_a or mf_b)
+* @param count Number of matrices in each array
+* @return void
+**/
+void LibAxis_Matrix43_MultiplyArrayF(float mf_a[][4][3], float mf_b[][4][3], float mf[][4][3], uint32_t count) {
+	uint32_t n;
+
+	for (n = 0; n < count; n++)
+	{
+		LibAxis_Matrix43_MultiplyF(mf_a[n], mf_b[n], mf[n]);
+	}
+}
+
+/**
+* @brief Multiply an array of 4x3 matrices by one matrix (mf[n] = mf_a[n] * mf_b),
+* e.g. concatenating local transforms with their parent.
+* @param mf_a Array of left hand side matrices
+* @param mf_b Shared right hand side matrix
+* @param mf Array of output matrices (may alias mf_a)
+* @param count Number of matrices in mf_a and mf
+* @return void
+**/
+void LibAxis_Matrix43_PostMultiplyArrayF(float mf_a[][4][3], float mf_b[4][3], float mf[][4][3], uint32_t count) {
+#if (LA_SIMD != LA_SIMD_SCALAR)
+	Matrix43RowsF rows;
+	uint32_t n;
+
+	/* mf_b is only read here, so it stays in registers for the whole batch. */
+	Matrix43_LoadRowsF(&rows, mf_b);
+
+	for (n = 0; n < count; n++)
+	{
+		Matrix43_MultiplyRowsF(mf_a[n], &rows, mf[n]);
+	}
+#else
+	float b[4][3];
+	uint32_t n;
+	int32_t i, j;
+
+	/* Copy the shared matrix so writing mf can never clobber it mid-batch. */
+	for (i = 0; i < 4; i++)
+	{
+		for (j = 0; j < 3; j++)
+		{
+			b[i][j] = mf_b[i][j];
+		}
+	}
+
+	for (n = 0; n < count; n++)
+	{
+		LibAxis_Matrix43_MultiplyF(mf_a[n], b, mf[n]);
+	}
+#endif
+}
+
+/**
+* @brief Transform a point by a 4x3 matrix (rotation, scale and translation).
+* @param mf The transform
+* @param point The point to transform
+* @return The transformed point
+**/
+Vec3f LibAxis_Matrix43_TransformPointF(float mf[4][3], Vec3f* point) {
+	Vec3f out;
+
+	out.x = (mf[0][0] * point->x) + (mf[1][0] * point->y) + (mf[2][0] * point->z) + mf[3][0];
+	out.y = (mf[0][1] * point->x) + (mf[1][1] * point->y) + (mf[2][1] * point->z) + mf[3][1];
+	out.z = (mf[0][2] * point->x) + (mf[1][2] * point->y) + (mf[2][2] * point->z) + mf[3][2];
+
+	return out;
+}
+
+/**
+* @brief Transform a direction by a 4x3 matrix (rotation and scale, no translation).
+* @param mf The transform
+* @param vector The direction to transform
+* @return The transformed direction
+**/
+Vec3f LibAxis_Matrix43_TransformVectorF(float mf[4][3], Vec3f* vector) {
+	Vec3f out;
+
+	out.x = (mf[0][0] * vector->x) + (mf[1][0] * vector->y) + (mf[2][0] * vector->z);
+	out.y = (mf[0][1] * vector->x) + (mf[1][1] * vector->y) + (mf[2][1] * vector->z);
+	out.z = (mf[0][2] * vector->x) + (mf[1][2] * vector->y) + (mf[2][2] * vector->z);
+
+	return out;
+}
+
+/**
+* @brief Transform an array of points by a 4x3 matrix.
+* @param mf The transform
+* @param out Array of transformed points (may alias in)
+* @param in Array of points to transform
+* @param count Number of points
+* @return void
+**/
+void LibAxis_Matrix43_TransformPointArrayF(float mf[4][3], Vec3f* out, Vec3f* in, uint32_t count) {
+	float m[4][3];
+	uint32_t n;
+	int32_t i, j;
+
+	for (i = 0; i < 4; i++)
+	{
+		for (j = 0; j < 3; j++)
+		{
+			m[i][j] = mf[i][j];
+		}
+	}
+
+	for (n = 0; n < count; n++)
+	{
+		out[n] = LibAxis_Matrix43_TransformPointF(m, &in[n]);
+	}
+}
+
+/**
+* @brief Transform an array of directions by a 4x3 matrix.
+* @param mf The transform
+* @param out Array of transformed directions (may alias in)
+* @param in Array of directions to transform
+* @param count Number of directions
+* @return void
+**/
+void LibAxis_Matrix43_TransformVectorArrayF(float mf[4][3], Vec3f* out, Vec3f* in, uint32_t count) {
+	float m[4][3];
+	uint32_t n;
+	int32_t i, j;
+
+	for (i = 0; i < 4; i++)
+	{
+		for (j = 0; j < 3; j++)
+		{
+			m[i][j] = mf[i][j];
+		}
+	}
+
+	for (n = 0; n < count; n++)
+	{
+		out[n] = LibAxis_Matrix43_TransformVectorF(m, &in[n]);
+	}
+}
+
+/**
+* @brief Invert a 4x3 affine matrix.
+* @param mf_a The matrix to invert
+* @param mf The output matrix (may alias mf_a), left untouched if mf_a is singular
+* @return 1 if mf_a was inverted, 0 if its 3x3 part is singular
+**/
+int32_t LibAxis_Matrix43_InverseF(float mf_a[4][3], float mf[4][3]) {
+	float m[4][3];
+	float det;
+	int32_t i, j;
+
+	for (i = 0; i < 4; i++)
+	{
+		for (j = 0; j < 3; j++)
+		{
+			m[i][j] = mf_a[i][j];
+		}
+	}
+
+	det = m[0][0] * (m[1][1] * m[2][2] - m[1][2] * m[2][1])
+		+ m[0][1] * (m[1][2] * m[2][0] - m[1][0] * m[2][2])
+		+ m[0][2] * (m[1][0] * m[2][1] - m[1][1] * m[2][0]);
+
+	if (det == 0.0f)
+		return 0;
+
+	det = 1.0f / det;
+
+	mf[0][0] = (m[1][1] * m[2][2] - m[1][2] * m[2][1]) * det;
+	mf[0][1] = (m[2][1] * m[0][2] - m[2][2] * m[0][1]) * det;
+	mf[0][2] = (m[0][1] * m[1][2] - m[0][2] * m[1][1]) * det;
+	mf[1][0] = (m[1][2] * m[2][0] - m[1][0] * m[2][2]) * det;
+	mf[1][1] = (m[2][2] * m[0][0] - m[2][0] * m[0][2]) * det;
+	mf[1][2] = (m[0][2] * m[1][0] - m[0][0] * m[1][2]) * det;
+	mf[2][0] = (m[1][0] * m[2][1] - m[1][1] * m[2][0]) * det;
+	mf[2][1] = (m[2][0] * m[0][1] - m[2][1] * m[0][0]) * det;
+	mf[2][2] = (m[0][0] * m[1][1] - m[0][1] * m[1][0]) * det;
+
+	for (j = 0; j < 3; j++)
+	{
+		mf[3][j] = -((m[3][0] * mf[0][j]) + (m[3][1] * mf[1][j]) + (m[3][2] * mf[2][j]));
+	}
+
+	return 1;
+}
+
+/**
+* @brief Expand a 4x3 matrix to a Matrix44 with a (0, 0, 0, 1) last column.
+* @param mf_a The 4x3 matrix
+* @param mf The output 4x4 matrix
+* @return void
+**/
+void LibAxis_Matrix43ToMatrix44F(float mf_a[4][3], float mf[4][4]) {
+	int32_t i, j;
+
+	for (i = 0; i < 4; i++)
+	{
+		for (j = 0; j < 3; j++)
+		{
+			mf[i][j] = mf_a[i][j];
+		}
+
+		mf[i][3] = (i == 3) ? 1.0f : 0.0f;
+	}
+}
+
+/**
+* @brief Drop the last column of an affine Matrix44.
+* @param mf_a The 4x4 matrix
+* @param mf The output 4x3 matrix
+* @return void
+**/
+void LibAxis_Matrix44ToMatrix43F(float mf_a[4][4], float mf[4][3]) {
+	int32_t i, j;
+
+	for (i = 0; i < 4; i++)
+	{
+		for (j = 0; j < 3; j++)
+		{
+			mf[i][j] = mf_a[i][j];
+		}
+	}
+}
+
+void LibAxis_Matrix43ToFixed44(Mtx44* m, float mf[4][3]) {
+	float mf44[4][4];
+
+	LibAxis_Matrix43ToMatrix44F(mf, mf44);
+	Matrix44_PackFixedF(m, mf44);
+}
+#endif
\ No newline at end of file
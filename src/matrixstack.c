@@ -0,0 +1,170 @@
+/**
+ * @file: matrixstack.c
+ * @author: CrookedPoe (https://github.com/CrookedPoe)
+ *
+ * @brief Matrix stack with deferred concatenation and fixed-point conversion.
+**/
+
+#include "../include/libaxis.h"
+
+#define MATRIXSTACK_IDENTITY    0x01    /* Local matrix is the identity */
+#define MATRIXSTACK_LOAD        0x02    /* Level replaces the levels below instead of multiplying them */
+#define MATRIXSTACK_FIXED       0x04    /* Fixed-point form matches the world matrix */
+
+static void MatrixStack_CopyF(float dst[4][4], float src[4][4]) {
+    int32_t r, c;
+
+    for (r = 0; r < 4; r++) {
+        for (c = 0; c < 4; c++)
+            dst[r][c] = src[r][c];
+    }
+}
+
+/* The top level changed, so its world matrix has to be rebuilt. */
+LA_INLINE void MatrixStack_InvalidateF(MatrixStack* stack) {
+    if (stack->valid > stack->depth)
+        stack->valid = stack->depth;
+}
+
+/**
+* @brief Point the arrays of a MatrixStack into a single buffer and reset it to one identity level.
+* @param stack The stack to initialize
+* @param buffer At least LA_MATRIXSTACK_BYTES(capacity) bytes, ideally 16 byte aligned
+* @param capacity Maximum number of levels, at least 1
+* @return void
+**/
+void LibAxis_MatrixStack_Init(MatrixStack* stack, void* buffer, uint32_t capacity) {
+    uint8_t* bytes = (uint8_t*)buffer;
+
+    stack->local = (float (*)[4][4])bytes;
+    stack->world = (float (*)[4][4])(bytes + (capacity * sizeof(float) * 16));
+    stack->fixed = (Mtx44*)(bytes + (capacity * sizeof(float) * 32));
+    stack->flags = (uint8_t*)(stack->fixed + capacity);
+    stack->capacity = capacity;
+    stack->depth = 0;
+    stack->valid = 0;
+    stack->flags[0] = MATRIXSTACK_IDENTITY | MATRIXSTACK_LOAD;
+}
+
+/**
+* @brief Push a level that starts out equal to the current top.
+* @param stack The stack
+* @return int32_t 1 on success, 0 if the stack is full
+**/
+int32_t LibAxis_MatrixStack_Push(MatrixStack* stack) {
+    if (stack->depth + 1 >= stack->capacity)
+        return 0;
+
+    stack->depth++;
+    stack->flags[stack->depth] = MATRIXSTACK_IDENTITY;
+    return 1;
+}
+
+/**
+* @brief Pop the top level. The level below keeps its cached matrices.
+* @param stack The stack
+* @return int32_t 1 on success, 0 if only the bottom level is left
+**/
+int32_t LibAxis_MatrixStack_Pop(MatrixStack* stack) {
+    if (stack->depth == 0)
+        return 0;
+
+    stack->depth--;
+    if (stack->valid > stack->depth + 1)
+        stack->valid = stack->depth + 1;
+
+    return 1;
+}
+
+/**
+* @brief Replace the top with the identity.
+* @param stack The stack
+* @return void
+**/
+void LibAxis_MatrixStack_Identity(MatrixStack* stack) {
+    stack->flags[stack->depth] = MATRIXSTACK_IDENTITY | MATRIXSTACK_LOAD;
+    MatrixStack_InvalidateF(stack);
+}
+
+/**
+* @brief Replace the top with a matrix, ignoring the levels below.
+* @param stack The stack
+* @param mf The new top
+* @return void
+**/
+void LibAxis_MatrixStack_Load(MatrixStack* stack, float mf[4][4]) {
+    MatrixStack_CopyF(stack->local[stack->depth], mf);
+    stack->flags[stack->depth] = MATRIXSTACK_LOAD;
+    MatrixStack_InvalidateF(stack);
+}
+
+/**
+* @brief Multiply a matrix onto the top, so that it applies to vertices before the current top (top = mf * top).
+* @param stack The stack
+* @param mf The matrix to apply
+* @return void
+**/
+void LibAxis_MatrixStack_Multiply(MatrixStack* stack, float mf[4][4]) {
+    float tmp[4][4];
+    uint8_t* flags = &stack->flags[stack->depth];
+
+    if (*flags & MATRIXSTACK_IDENTITY) {
+        MatrixStack_CopyF(stack->local[stack->depth], mf);
+    }
+    else {
+        LibAxis_Matrix44_MultiplyF(mf, stack->local[stack->depth], tmp);
+        MatrixStack_CopyF(stack->local[stack->depth], tmp);
+    }
+
+    *flags &= MATRIXSTACK_LOAD;
+    MatrixStack_InvalidateF(stack);
+}
+
+/**
+* @brief Concatenate the levels changed since the last read and return the top.
+* @param stack The stack
+* @return float(*)[4] The top matrix, valid until the stack is next changed
+**/
+float (*LibAxis_MatrixStack_Top(MatrixStack* stack))[4] {
+    uint32_t d;
+    uint8_t flags;
+
+    for (d = stack->valid; d <= stack->depth; d++) {
+        flags = stack->flags[d];
+
+        if (d == 0 || (flags & MATRIXSTACK_LOAD)) {
+            if (flags & MATRIXSTACK_IDENTITY)
+                LibAxis_Matrix44_IdentityF(stack->world[d]);
+            else
+                MatrixStack_CopyF(stack->world[d], stack->local[d]);
+        }
+        else if (flags & MATRIXSTACK_IDENTITY) {
+            MatrixStack_CopyF(stack->world[d], stack->world[d - 1]);
+        }
+        else {
+            LibAxis_Matrix44_MultiplyF(stack->local[d], stack->world[d - 1], stack->world[d]);
+        }
+
+        stack->flags[d] = flags & ~MATRIXSTACK_FIXED;
+    }
+
+    stack->valid = stack->depth + 1;
+    return stack->world[stack->depth];
+}
+
+/**
+* @brief Return the top in fixed-point form, converting it only if it changed since the last conversion.
+* @param stack The stack
+* @return Mtx44* The top matrix, valid until the stack is next changed
+**/
+Mtx44* LibAxis_MatrixStack_TopFixed(MatrixStack* stack) {
+    float (*top)[4] = LibAxis_MatrixStack_Top(stack);
+    uint8_t* flags = &stack->flags[stack->depth];
+
+    if (!(*flags & MATRIXSTACK_FIXED)) {
+        LibAxis_Matrix44ToFixed44(&stack->fixed[stack->depth], top);
+        *flags |= MATRIXSTACK_FIXED;
+    }
+
+    return &stack->fixed[stack->depth];
+}
@@ -0,0 +1,226 @@
+/**
+ * @file: pose.c
+ * @author: CrookedPoe (https://github.com/CrookedPoe)
+ *
+ * @brief Animation pose blending and skinning matrix palettes.
+**/
+
+#include "../include/libaxis.h"
+
+/* out[i] = a[i] + (b[i] - a[i]) * t over a flat run of floats, as Vec3fStream_Lerp. */
+static void Pose_LerpF(float* out, float* a, float* b, float t, uint32_t count) {
+    LA_F32xN va;
+    uint32_t i;
+
+    for (i = 0; i + LA_SIMD_WIDTH <= count; i += LA_SIMD_WIDTH) {
+        va = LA_LOADN(&a[i]);
+        LA_STOREN(&out[i], va + (LA_LOADN(&b[i]) - va) * t);
+    }
+
+    for (; i < count; i++)
+        out[i] = a[i] + (b[i] - a[i]) * t;
+}
+
+/* out[i] = out[i] + a[i] * w over a flat run of floats; out is overwritten instead when first is set. */
+static void Pose_AccumulateF(float* out, float* a, float w, uint32_t count, int32_t first) {
+    uint32_t i;
+
+    for (i = 0; i + LA_SIMD_WIDTH <= count; i += LA_SIMD_WIDTH) {
+        if (first)
+            LA_STOREN(&out[i], LA_LOADN(&a[i]) * w);
+        else
+            LA_STOREN(&out[i], LA_LOADN(&out[i]) + LA_LOADN(&a[i]) * w);
+    }
+
+    for (; i < count; i++)
+        out[i] = first ? (a[i] * w) : (out[i] + a[i] * w);
+}
+
+/**
+* @brief Point the channels of a Pose into a single buffer.
+* @param pose The pose to initialize
+* @param buffer At least LA_POSE_FLOATS(count) floats, ideally 16 byte aligned
+* @param count Number of bones
+* @return void
+**/
+void LibAxis_Pose_Init(Pose* pose, float* buffer, uint32_t count) {
+    pose->rotation = (QuatF*)buffer;
+    pose->translation = (Vec3f*)(buffer + (count * 4));
+    pose->scale = (Vec3f*)(buffer + (count * 7));
+    pose->count = count;
+}
+
+/**
+* @brief Reset every bone of a pose to the identity transform.
+* @param pose The pose to reset
+* @return void
+**/
+void LibAxis_Pose_Identity(Pose* pose) {
+    uint32_t i;
+
+    for (i = 0; i < pose->count; i++) {
+        pose->rotation[i] = QuatF_Identity;
+        pose->translation[i] = Vec3f_Zero;
+        pose->scale[i] = VEC3F_NEW(1.0f, 1.0f, 1.0f);
+    }
+}
+
+/**
+* @brief Blend two poses: translation and scale are lerped, rotation is nlerped along the shorter arc.
+* @param out Output pose (may be lhs or rhs)
+* @param lhs Start pose (t = 0)
+* @param rhs End pose (t = 1)
+* @param t Interpolation factor
+* @return void
+**/
+void LibAxis_Pose_Blend(Pose* out, Pose* lhs, Pose* rhs, float t) {
+    uint32_t count = lhs->count;
+
+    LibAxis_QuatF_NlerpArray(out->rotation, lhs->rotation, rhs->rotation, t, count);
+    Pose_LerpF(&out->translation[0].x, &lhs->translation[0].x, &rhs->translation[0].x, t, count * 3);
+    Pose_LerpF(&out->scale[0].x, &lhs->scale[0].x, &rhs->scale[0].x, t, count * 3);
+}
+
+/**
+* @brief Blend any number of poses by weight.
+* Translation and scale are weighted sums. Rotations are summed after being flipped into the
+* hemisphere of the running total, then normalized. The weights should add up to 1.
+* @param out Output pose (may be poses[0], but no other input)
+* @param poses Array of pose_count poses with out->count bones each
+* @param weights Weight of each pose
+* @param pose_count Number of poses
+* @return void
+**/
+void LibAxis_Pose_BlendWeighted(Pose* out, Pose** poses, float* weights, uint32_t pose_count) {
+    uint32_t count = out->count;
+    uint32_t i, k;
+    QuatF* q;
+    QuatF* o;
+    float w, s;
+
+    for (k = 0; k < pose_count; k++) {
+        w = weights[k];
+        Pose_AccumulateF(&out->translation[0].x, &poses[k]->translation[0].x, w, count * 3, k == 0);
+        Pose_AccumulateF(&out->scale[0].x, &poses[k]->scale[0].x, w, count * 3, k == 0);
+
+        q = poses[k]->rotation;
+        for (i = 0; i < count; i++) {
+            o = &out->rotation[i];
+            if (k == 0) {
+                o->x = q[i].x * w;
+                o->y = q[i].y * w;
+                o->z = q[i].z * w;
+                o->w = q[i].w * w;
+                continue;
+            }
+
+            s = (((o->x * q[i].x) + (o->y * q[i].y) + (o->z * q[i].z) + (o->w * q[i].w)) < 0.0f) ? -w : w;
+            o->x += q[i].x * s;
+            o->y += q[i].y * s;
+            o->z += q[i].z * s;
+            o->w += q[i].w * s;
+        }
+    }
+
+    LibAxis_QuatF_NormalizeArray(out->rotation, out->rotation, count);
+}
+
+/**
+* @brief Build the local matrix (scale * rotation * translation) of every bone.
+* @param mf Array of pose->count output matrices
+* @param pose Pose with unit rotations
+* @return void
+**/
+void LibAxis_Pose_LocalMatrices(float mf[][4][4], Pose* pose) {
+    float x2, y2, z2, xx, yy, zz, xy, xz, yz, wx, wy, wz;
+    QuatF* q;
+    Vec3f* s;
+    Vec3f* t;
+    uint32_t i;
+
+    for (i = 0; i < pose->count; i++) {
+        q = &pose->rotation[i];
+        s = &pose->scale[i];
+        t = &pose->translation[i];
+
+        x2 = q->x + q->x;
+        y2 = q->y + q->y;
+        z2 = q->z + q->z;
+        xx = q->x * x2;
+        yy = q->y * y2;
+        zz = q->z * z2;
+        xy = q->x * y2;
+        xz = q->x * z2;
+        yz = q->y * z2;
+        wx = q->w * x2;
+        wy = q->w * y2;
+        wz = q->w * z2;
+
+        /* Row n is basis vector n rotated by q, so v * mf matches QuatF_RotateVec3f. */
+        mf[i][0][0] = s->x * (1.0f - (yy + zz));
+        mf[i][0][1] = s->x * (xy + wz);
+        mf[i][0][2] = s->x * (xz - wy);
+        mf[i][0][3] = 0.0f;
+        mf[i][1][0] = s->y * (xy - wz);
+        mf[i][1][1] = s->y * (1.0f - (xx + zz));
+        mf[i][1][2] = s->y * (yz + wx);
+        mf[i][1][3] = 0.0f;
+        mf[i][2][0] = s->z * (xz + wy);
+        mf[i][2][1] = s->z * (yz - wx);
+        mf[i][2][2] = s->z * (1.0f - (xx + yy));
+        mf[i][2][3] = 0.0f;
+        mf[i][3][0] = t->x;
+        mf[i][3][1] = t->y;
+        mf[i][3][2] = t->z;
+        mf[i][3][3] = 1.0f;
+    }
+}
+
+/**
+* @brief Build the model-space matrix of every bone by walking the hierarchy.
+* @param mf Array of pose->count output matrices
+* @param pose Pose with unit rotations
+* @param parents Parent index of every bone, parents[i] < i, LA_POSE_ROOT for roots
+* @return void
+**/
+void LibAxis_Pose_ModelMatrices(float mf[][4][4], Pose* pose, int32_t* parents) {
+    uint32_t i;
+
+    LibAxis_Pose_LocalMatrices(mf, pose);
+
+    /* The array form is used one matrix at a time because, unlike LibAxis_Matrix44_MultiplyF, it may write over its input. */
+    for (i = 0; i < pose->count; i++) {
+        if (parents[i] >= 0)
+            LibAxis_Matrix44_MultiplyArrayF(&mf[i], &mf[parents[i]], &mf[i], 1);
+    }
+}
+
+/**
+* @brief Build the skinning palette (palette[n] = inverse_bind[n] * model[n]).
+* @param palette Array of output matrices (may alias model or inverse_bind)
+* @param model Model-space bone matrices, see LibAxis_Pose_ModelMatrices
+* @param inverse_bind Inverse of every bone's bind-pose model matrix
+* @param count Number of bones
+* @return void
+**/
+void LibAxis_Pose_SkinningMatrices(float palette[][4][4], float model[][4][4], float inverse_bind[][4][4], uint32_t count) {
+    LibAxis_Matrix44_MultiplyArrayF(inverse_bind, model, palette, count);
+}
+
+/**
+* @brief Build the skinning palette (palette[n] = inverse_bind[n] * model[n]) as fixed-point Mtx44.
+* @param palette Array of count output matrices
+* @param model Model-space bone matrices, see LibAxis_Pose_ModelMatrices
+* @param inverse_bind Inverse of every bone's bind-pose model matrix
+* @param count Number of bones
+* @return void
+**/
+void LibAxis_Pose_SkinningMatricesFixed(Mtx44* palette, float model[][4][4], float inverse_bind[][4][4], uint32_t count) {
+    float mf[4][4];
+    uint32_t i;
+
+    for (i = 0; i < count; i++) {
+        LibAxis_Matrix44_MultiplyArrayF(&inverse_bind[i], &model[i], &mf, 1);
+        LibAxis_Matrix44ToFixed44(&palette[i], mf);
+    }
+}
\ No newline at end of file
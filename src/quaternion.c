@@ -0,0 +1,403 @@
+/**
+ * @file: quaternion.c
+ * @author: CrookedPoe (https://github.com/CrookedPoe)
+ *
+ * @brief Batched quaternion products, rotations and interpolation.
+**/
+
+#include "../include/libaxis.h"
+
+/*
+ * The SIMD kernels take LA_SIMD_WIDTH quaternions (or Vec3f) per step, transposed
+ * into x/y/z/w lanes four at a time, and run the same arithmetic as the scalar
+ * QuatF_* functions in every lane, so the results match them exactly. A partial
+ * last step is staged through zero-padded locals rather than finished in scalar
+ * code, so every element of an array goes through the same kernel.
+ */
+#if (LA_SIMD != LA_SIMD_SCALAR)
+#define QUAT_LANES LA_SIMD_WIDTH
+
+/* Full {x, y, z, w} two-source shuffle, indices 4-7 select from B. */
+#define QUAT_SHUFFLE(A, B, X, Y, Z, W) __builtin_shuffle((A), (B), (LA_I32x4){(X), (Y), (Z), (W)})
+
+#if (LA_SIMD_WIDTH == 8)
+#define QUAT_JOIN(LO, HI) ((LA_F32xN){(LO)[0], (LO)[1], (LO)[2], (LO)[3], (HI)[0], (HI)[1], (HI)[2], (HI)[3]})
+#define QUAT_HALF(V, H)   ((LA_F32x4){(V)[(H) * 4], (V)[(H) * 4 + 1], (V)[(H) * 4 + 2], (V)[(H) * 4 + 3]})
+#else
+#define QUAT_JOIN(LO, HI) (LO)
+#define QUAT_HALF(V, H)   (V)
+#endif
+
+typedef struct {
+    LA_F32xN x, y, z, w;
+} QuatLanesF;
+
+typedef struct {
+    LA_F32xN x, y, z;
+} Vec3LanesF;
+
+LA_INLINE void Quat_Load4F(QuatF* q, LA_F32x4* x, LA_F32x4* y, LA_F32x4* z, LA_F32x4* w) {
+    LA_F32x4 r0 = LA_LOAD4(&q[0]);
+    LA_F32x4 r1 = LA_LOAD4(&q[1]);
+    LA_F32x4 r2 = LA_LOAD4(&q[2]);
+    LA_F32x4 r3 = LA_LOAD4(&q[3]);
+
+    LA_TRANSPOSE4(r0, r1, r2, r3);
+    *x = r0;
+    *y = r1;
+    *z = r2;
+    *w = r3;
+}
+
+LA_INLINE void Quat_Store4F(QuatF* q, LA_F32x4 r0, LA_F32x4 r1, LA_F32x4 r2, LA_F32x4 r3) {
+    LA_TRANSPOSE4(r0, r1, r2, r3);
+    LA_STORE4(&q[0], r0);
+    LA_STORE4(&q[1], r1);
+    LA_STORE4(&q[2], r2);
+    LA_STORE4(&q[3], r3);
+}
+
+LA_INLINE void Quat_LoadLanesF(QuatLanesF* l, QuatF* q) {
+    LA_F32x4 x0, y0, z0, w0;
+#if (LA_SIMD_WIDTH == 8)
+    LA_F32x4 x1, y1, z1, w1;
+
+    Quat_Load4F(&q[4], &x1, &y1, &z1, &w1);
+#endif
+    Quat_Load4F(&q[0], &x0, &y0, &z0, &w0);
+    l->x = QUAT_JOIN(x0, x1);
+    l->y = QUAT_JOIN(y0, y1);
+    l->z = QUAT_JOIN(z0, z1);
+    l->w = QUAT_JOIN(w0, w1);
+}
+
+LA_INLINE void Quat_StoreLanesF(QuatF* q, QuatLanesF* l) {
+    Quat_Store4F(&q[0], QUAT_HALF(l->x, 0), QUAT_HALF(l->y, 0), QUAT_HALF(l->z, 0), QUAT_HALF(l->w, 0));
+#if (LA_SIMD_WIDTH == 8)
+    Quat_Store4F(&q[4], QUAT_HALF(l->x, 1), QUAT_HALF(l->y, 1), QUAT_HALF(l->z, 1), QUAT_HALF(l->w, 1));
+#endif
+}
+
+/* Four packed Vec3f are {x0 y0 z0 x1} {y1 z1 x2 y2} {z2 x3 y3 z3}. */
+LA_INLINE void Vec3_Load4F(Vec3f* v, LA_F32x4* x, LA_F32x4* y, LA_F32x4* z) {
+    LA_F32x4 a = LA_LOAD4(&v[0].x);
+    LA_F32x4 b = LA_LOAD4(&v[1].y);
+    LA_F32x4 c = LA_LOAD4(&v[2].z);
+
+    *x = QUAT_SHUFFLE(QUAT_SHUFFLE(a, b, 0, 3, 6, 7), c, 0, 1, 2, 5);
+    *y = QUAT_SHUFFLE(QUAT_SHUFFLE(a, b, 1, 4, 7, 7), c, 0, 1, 2, 6);
+    *z = QUAT_SHUFFLE(QUAT_SHUFFLE(a, b, 2, 5, 5, 5), c, 0, 1, 4, 7);
+}
+
+LA_INLINE void Vec3_Store4F(Vec3f* v, LA_F32x4 x, LA_F32x4 y, LA_F32x4 z) {
+    LA_STORE4(&v[0].x, QUAT_SHUFFLE(QUAT_SHUFFLE(x, y, 0, 4, 1, 5), z, 0, 1, 4, 2));
+    LA_STORE4(&v[1].y, QUAT_SHUFFLE(QUAT_SHUFFLE(y, z, 1, 5, 2, 6), x, 0, 1, 6, 2));
+    LA_STORE4(&v[2].z, QUAT_SHUFFLE(QUAT_SHUFFLE(z, x, 2, 7, 3, 3), y, 0, 1, 7, 2));
+}
+
+LA_INLINE void Vec3_LoadLanesF(Vec3LanesF* l, Vec3f* v) {
+    LA_F32x4 x0, y0, z0;
+#if (LA_SIMD_WIDTH == 8)
+    LA_F32x4 x1, y1, z1;
+
+    Vec3_Load4F(&v[4], &x1, &y1, &z1);
+#endif
+    Vec3_Load4F(&v[0], &x0, &y0, &z0);
+    l->x = QUAT_JOIN(x0, x1);
+    l->y = QUAT_JOIN(y0, y1);
+    l->z = QUAT_JOIN(z0, z1);
+}
+
+LA_INLINE void Vec3_StoreLanesF(Vec3f* v, Vec3LanesF* l) {
+    Vec3_Store4F(&v[0], QUAT_HALF(l->x, 0), QUAT_HALF(l->y, 0), QUAT_HALF(l->z, 0));
+#if (LA_SIMD_WIDTH == 8)
+    Vec3_Store4F(&v[4], QUAT_HALF(l->x, 1), QUAT_HALF(l->y, 1), QUAT_HALF(l->z, 1));
+#endif
+}
+
+/* out = a * b, as QuatF_MultiplyAssignment. out may be a or b. */
+LA_INLINE void Quat_MultiplyLanesF(QuatLanesF* out, QuatLanesF* a, QuatLanesF* b) {
+    LA_F32xN x = (a->w * b->x) + (a->x * b->w) + (a->y * b->z) - (a->z * b->y);
+    LA_F32xN y = (a->w * b->y) - (a->x * b->z) + (a->y * b->w) + (a->z * b->x);
+    LA_F32xN z = (a->w * b->z) + (a->x * b->y) - (a->y * b->x) + (a->z * b->w);
+    LA_F32xN w = (a->w * b->w) - (a->x * b->x) - (a->y * b->y) - (a->z * b->z);
+
+    out->x = x;
+    out->y = y;
+    out->z = z;
+    out->w = w;
+}
+
+/* Normalize the lanes selected by mask, as Vec4f_NormalizeAssignment; the others pass through. */
+LA_INLINE void Quat_NormalizeLanesF(QuatLanesF* out, QuatLanesF* q, LA_I32xN mask) {
+    const LA_F32xN zero = {0.0f};
+    LA_F32xN magnitude = LA_SqrtN((q->x * q->x) + (q->y * q->y) + (q->z * q->z) + (q->w * q->w), LA_SQRT_PRECISE);
+    LA_I32xN nonzero = (magnitude != 0.0f);
+    LA_F32xN divisor = LA_SELECTN(nonzero, magnitude, zero + 1.0f);
+
+    out->x = LA_SELECTN(mask, LA_SELECTN(nonzero, q->x / divisor, zero), q->x);
+    out->y = LA_SELECTN(mask, LA_SELECTN(nonzero, q->y / divisor, zero), q->y);
+    out->z = LA_SELECTN(mask, LA_SELECTN(nonzero, q->z / divisor, zero), q->z);
+    out->w = LA_SELECTN(mask, LA_SELECTN(nonzero, q->w / divisor, zero), q->w);
+}
+
+/* out = a * u + b * s, then normalized in the lanes selected by renormalize. */
+LA_INLINE void Quat_BlendLanesF(QuatLanesF* out, QuatLanesF* a, QuatLanesF* b, LA_F32xN u, LA_F32xN s, LA_I32xN renormalize) {
+    QuatLanesF r;
+
+    r.x = (a->x * u) + (b->x * s);
+    r.y = (a->y * u) + (b->y * s);
+    r.z = (a->z * u) + (b->z * s);
+    r.w = (a->w * u) + (b->w * s);
+    Quat_NormalizeLanesF(out, &r, renormalize);
+}
+
+LA_INLINE LA_F32xN Quat_DotLanesF(QuatLanesF* a, QuatLanesF* b) {
+    return (a->x * b->x) + (a->y * b->y) + (a->z * b->z) + (a->w * b->w);
+}
+
+LA_INLINE void Quat_MultiplyStepF(QuatF* out, QuatF* lhs, QuatF* rhs) {
+    QuatLanesF a, b;
+
+    Quat_LoadLanesF(&a, lhs);
+    Quat_LoadLanesF(&b, rhs);
+    Quat_MultiplyLanesF(&a, &a, &b);
+    Quat_StoreLanesF(out, &a);
+}
+
+LA_INLINE void Quat_NormalizeStepF(QuatF* out, QuatF* in) {
+    const LA_F32xN zero = {0.0f};
+    QuatLanesF q;
+
+    Quat_LoadLanesF(&q, in);
+    Quat_NormalizeLanesF(&q, &q, zero == zero);
+    Quat_StoreLanesF(out, &q);
+}
+
+/* As QuatF_RotateVec3fAssignment. */
+LA_INLINE void Quat_RotateStepF(Vec3f* out, QuatF* quat, Vec3f* in) {
+    QuatLanesF q;
+    Vec3LanesF v, r;
+    LA_F32xN qx2, qy2, qz2, tx, ty, tz;
+
+    Quat_LoadLanesF(&q, quat);
+    Vec3_LoadLanesF(&v, in);
+    qx2 = q.x + q.x;
+    qy2 = q.y + q.y;
+    qz2 = q.z + q.z;
+    tx = (qy2 * v.z) - (qz2 * v.y);
+    ty = (qz2 * v.x) - (qx2 * v.z);
+    tz = (qx2 * v.y) - (qy2 * v.x);
+    r.x = v.x + (q.w * tx) + ((q.y * tz) - (q.z * ty));
+    r.y = v.y + (q.w * ty) + ((q.z * tx) - (q.x * tz));
+    r.z = v.z + (q.w * tz) + ((q.x * ty) - (q.y * tx));
+    Vec3_StoreLanesF(out, &r);
+}
+
+/* As QuatF_NlerpAssignment. */
+LA_INLINE void Quat_NlerpStepF(QuatF* out, QuatF* lhs, QuatF* rhs, float t) {
+    const LA_F32xN zero = {0.0f};
+    QuatLanesF a, b;
+    LA_F32xN vt = zero + t;
+
+    Quat_LoadLanesF(&a, lhs);
+    Quat_LoadLanesF(&b, rhs);
+    Quat_BlendLanesF(&a, &a, &b, zero + (1.0f - t), LA_SELECTN(Quat_DotLanesF(&a, &b) < zero, -vt, vt), zero == zero);
+    Quat_StoreLanesF(out, &a);
+}
+
+/* As QuatF_SlerpAssignment, with both the slerp and nlerp weights computed and selected per lane. */
+static void Quat_SlerpStepF(QuatF* out, QuatF* lhs, QuatF* rhs, float t) {
+    const LA_F32xN zero = {0.0f};
+    QuatLanesF a, b;
+    LA_F32xN d, theta, recip, s0, s1, c, u, s;
+    LA_I32xN negative, linear;
+
+    Quat_LoadLanesF(&a, lhs);
+    Quat_LoadLanesF(&b, rhs);
+    d = Quat_DotLanesF(&a, &b);
+    negative = (d < zero);
+    d = LA_SELECTN(negative, -d, d);
+    linear = (d > LA_QUAT_SLERP_LINEAR);
+
+    theta = LA_ACosN(d);
+    recip = 1.0f / LA_SqrtN(1.0f - (d * d), LA_SQRT_PRECISE);
+    LA_SinCosN((1.0f - t) * theta, &s0, &c);
+    LA_SinCosN(t * theta, &s1, &c);
+
+    u = LA_SELECTN(linear, zero + (1.0f - t), s0 * recip);
+    s = LA_SELECTN(linear, zero + t, s1 * recip);
+    Quat_BlendLanesF(&a, &a, &b, u, LA_SELECTN(negative, -s, s), linear);
+    Quat_StoreLanesF(out, &a);
+}
+
+/* Copy count elements into a QUAT_LANES block, zeroing the rest. */
+static void Quat_StageF(QuatF* dst, QuatF* src, uint32_t count) {
+    const QuatF zero = {0.0f, 0.0f, 0.0f, 0.0f};
+    uint32_t i;
+
+    for (i = 0; i < QUAT_LANES; i++)
+        dst[i] = (i < count) ? src[i] : zero;
+}
+
+static void Vec3_StageF(Vec3f* dst, Vec3f* src, uint32_t count) {
+    const Vec3f zero = {0.0f, 0.0f, 0.0f};
+    uint32_t i;
+
+    for (i = 0; i < QUAT_LANES; i++)
+        dst[i] = (i < count) ? src[i] : zero;
+}
+#endif
+
+/**
+* @brief Computes the Hamilton product of every pair of quaternions.
+* (QuatF)out[i] = (QuatF)lhs[i] * (QuatF)rhs[i];
+* @param out Output array (may be lhs or rhs)
+* @param lhs Left Hand Side
+* @param rhs Right Hand Side (applied first)
+* @param count Number of quaternions
+* @return void
+**/
+void LibAxis_QuatF_MultiplyArray(QuatF* out, QuatF* lhs, QuatF* rhs, uint32_t count) {
+    uint32_t i;
+
+#if (LA_SIMD != LA_SIMD_SCALAR)
+    QuatF a[QUAT_LANES], b[QUAT_LANES];
+
+    for (i = 0; i + QUAT_LANES <= count; i += QUAT_LANES)
+        Quat_MultiplyStepF(&out[i], &lhs[i], &rhs[i]);
+
+    if (i < count) {
+        Quat_StageF(a, &lhs[i], count - i);
+        Quat_StageF(b, &rhs[i], count - i);
+        Quat_MultiplyStepF(a, a, b);
+        for (; i < count; i++)
+            out[i] = a[i % QUAT_LANES];
+    }
+#else
+    for (i = 0; i < count; i++)
+        out[i] = QuatF_Multiply(lhs[i], rhs[i]);
+#endif
+}
+
+/**
+* @brief Normalizes every quaternion in into a unit quaternion. Zero-length quaternions stay zero.
+* @param out Output array (may be in)
+* @param in Input array
+* @param count Number of quaternions
+* @return void
+**/
+void LibAxis_QuatF_NormalizeArray(QuatF* out, QuatF* in, uint32_t count) {
+    uint32_t i;
+
+#if (LA_SIMD != LA_SIMD_SCALAR)
+    QuatF a[QUAT_LANES];
+
+    for (i = 0; i + QUAT_LANES <= count; i += QUAT_LANES)
+        Quat_NormalizeStepF(&out[i], &in[i]);
+
+    if (i < count) {
+        Quat_StageF(a, &in[i], count - i);
+        Quat_NormalizeStepF(a, a);
+        for (; i < count; i++)
+            out[i] = a[i % QUAT_LANES];
+    }
+#else
+    for (i = 0; i < count; i++)
+        out[i] = QuatF_Normalize(in[i]);
+#endif
+}
+
+/**
+* @brief Rotates every vector in by the matching unit quaternion.
+* (Vec3f)out[i] = (QuatF)quat[i] * (Vec3f)in[i] * (QuatF)quat[i]^-1;
+* @param out Output array (may be in)
+* @param quat Unit quaternions
+* @param in Vectors to rotate
+* @param count Number of vectors
+* @return void
+**/
+void LibAxis_QuatF_RotateVec3fArray(Vec3f* out, QuatF* quat, Vec3f* in, uint32_t count) {
+    uint32_t i;
+
+#if (LA_SIMD != LA_SIMD_SCALAR)
+    QuatF q[QUAT_LANES];
+    Vec3f v[QUAT_LANES];
+
+    for (i = 0; i + QUAT_LANES <= count; i += QUAT_LANES)
+        Quat_RotateStepF(&out[i], &quat[i], &in[i]);
+
+    if (i < count) {
+        Quat_StageF(q, &quat[i], count - i);
+        Vec3_StageF(v, &in[i], count - i);
+        Quat_RotateStepF(v, q, v);
+        for (; i < count; i++)
+            out[i] = v[i % QUAT_LANES];
+    }
+#else
+    for (i = 0; i < count; i++)
+        out[i] = QuatF_RotateVec3f(&quat[i], in[i]);
+#endif
+}
+
+/**
+* @brief Normalized lerp from every quaternion in lhs towards the matching one in rhs, along the shorter arc.
+* @param out Output array (may be lhs or rhs)
+* @param lhs Start (t = 0)
+* @param rhs End (t = 1)
+* @param t Interpolation factor
+* @param count Number of quaternions
+* @return void
+**/
+void LibAxis_QuatF_NlerpArray(QuatF* out, QuatF* lhs, QuatF* rhs, float t, uint32_t count) {
+    uint32_t i;
+
+#if (LA_SIMD != LA_SIMD_SCALAR)
+    QuatF a[QUAT_LANES], b[QUAT_LANES];
+
+    for (i = 0; i + QUAT_LANES <= count; i += QUAT_LANES)
+        Quat_NlerpStepF(&out[i], &lhs[i], &rhs[i], t);
+
+    if (i < count) {
+        Quat_StageF(a, &lhs[i], count - i);
+        Quat_StageF(b, &rhs[i], count - i);
+        Quat_NlerpStepF(a, a, b, t);
+        for (; i < count; i++)
+            out[i] = a[i % QUAT_LANES];
+    }
+#else
+    for (i = 0; i < count; i++)
+        out[i] = QuatF_Nlerp(lhs[i], rhs[i], t);
+#endif
+}
+
+/**
+* @brief Spherical lerp from every unit quaternion in lhs towards the matching one in rhs, along the shorter arc.
+* @param out Output array (may be lhs or rhs)
+* @param lhs Start (t = 0)
+* @param rhs End (t = 1)
+* @param t Interpolation factor
+* @param count Number of quaternions
+* @return void
+**/
+void LibAxis_QuatF_SlerpArray(QuatF* out, QuatF* lhs, QuatF* rhs, float t, uint32_t count) {
+    uint32_t i;
+
+#if (LA_SIMD != LA_SIMD_SCALAR)
+    QuatF a[QUAT_LANES], b[QUAT_LANES];
+
+    for (i = 0; i + QUAT_LANES <= count; i += QUAT_LANES)
+        Quat_SlerpStepF(&out[i], &lhs[i], &rhs[i], t);
+
+    if (i < count) {
+        Quat_StageF(a, &lhs[i], count - i);
+        Quat_StageF(b, &rhs[i], count - i);
+        Quat_SlerpStepF(a, a, b, t);
+        for (; i < count; i++)
+            out[i] = a[i % QUAT_LANES];
+    }
+#else
+    for (i = 0; i < count; i++)
+        out[i] = QuatF_Slerp(lhs[i], rhs[i], t);
+#endif
+}
\ No newline at end of file
@@ -0,0 +1,297 @@
+/**
+ * @file: ray.c
+ * @author: CrookedPoe (https://github.com/CrookedPoe)
+ *
+ * @brief Ray-triangle, ray-box and ray-sphere intersection, singly and in packets.
+**/
+
+#include "../include/libaxis.h"
+
+/*
+ * The packet kernels repeat the arithmetic of the single tests lane for lane,
+ * in the same order, so a ray gets the same hit either way. They are built a
+ * second time for AVX2 by dispatch_avx2.c, which skips the single tests.
+ */
+#define RAY_EPSILON 1e-12f
+
+/* Vec3f_Sub, Vec3f_Dot and Vec3f_Cross, inlined; calling out for every one of them costs more than the test itself. */
+LA_INLINE Vec3f Ray_SubF(Vec3f* a, Vec3f* b) {
+    return VEC3F_NEW(a->x - b->x, a->y - b->y, a->z - b->z);
+}
+
+LA_INLINE float Ray_DotF(Vec3f* a, Vec3f* b) {
+    return (a->x * b->x) + (a->y * b->y) + (a->z * b->z);
+}
+
+LA_INLINE Vec3f Ray_CrossF(Vec3f* a, Vec3f* b) {
+    return VEC3F_NEW((a->y * b->z) - (b->y * a->z), (a->z * b->x) - (b->z * a->x), (a->x * b->y) - (b->x * a->y));
+}
+
+LA_INLINE LA_F32xN Ray_MinN(LA_F32xN a, LA_F32xN b) {
+    return LA_SELECTN(a < b, a, b);
+}
+
+LA_INLINE LA_F32xN Ray_MaxN(LA_F32xN a, LA_F32xN b) {
+    return LA_SELECTN(a > b, a, b);
+}
+
+/* Write t, u, v and index into the lanes of hits at i selected by hit; the other lanes keep their nearer hit. */
+LA_INLINE void Ray_StoreN(RayHitStream* hits, uint32_t i, LA_I32xN hit, LA_F32xN t, LA_F32xN u, LA_F32xN v, int32_t index) {
+    LA_STOREN(&hits->t[i], LA_SELECTN(hit, t, LA_LOADN(&hits->t[i])));
+    LA_STOREN(&hits->u[i], LA_SELECTN(hit, u, LA_LOADN(&hits->u[i])));
+    LA_STOREN(&hits->v[i], LA_SELECTN(hit, v, LA_LOADN(&hits->v[i])));
+    LA_STORENI(&hits->index[i], (hit & index) | (~hit & LA_LOADNI(&hits->index[i])));
+}
+
+#ifndef LA_DISPATCH_VARIANT
+/**
+* @brief Point the planes of a RayHitStream into a single buffer and clear them.
+* @param hits The stream to initialize
+* @param buffer At least LA_RAY_HIT_FLOATS(count) floats, ideally LA_STREAM_ALIGN aligned
+* @param count Number of rays
+* @param t_max Maximum hit distance of every ray
+* @return void
+**/
+void LibAxis_Ray_InitHits(RayHitStream* hits, float* buffer, uint32_t count, float t_max) {
+    uint32_t pad = LA_STREAM_PAD(count);
+    uint32_t i;
+
+    hits->t = buffer;
+    hits->u = buffer + pad;
+    hits->v = buffer + (pad * 2);
+    hits->index = (int32_t*)(buffer + (pad * 3));
+    hits->count = count;
+
+    for (i = 0; i < pad; i++) {
+        hits->t[i] = t_max;
+        hits->u[i] = hits->v[i] = 0.0f;
+        hits->index[i] = LA_RAY_MISS;
+    }
+}
+
+/**
+* @brief Intersect a ray with a triangle (Moller-Trumbore). Both faces are hit.
+* @param hit Nearest hit so far; updated if the triangle is closer than hit->t
+* @param origin Ray origin
+* @param direction Ray direction, need not be normalized
+* @param v The three vertices of the triangle
+* @return int32_t 1 if hit was updated, otherwise 0
+**/
+int32_t LibAxis_Ray_Triangle(RayHit* hit, Vec3f* origin, Vec3f* direction, Vec3f* v) {
+    Vec3f e1 = Ray_SubF(&v[1], &v[0]);
+    Vec3f e2 = Ray_SubF(&v[2], &v[0]);
+    Vec3f s = Ray_SubF(origin, &v[0]);
+    Vec3f p = Ray_CrossF(direction, &e2);
+    Vec3f q = Ray_CrossF(&s, &e1);
+    float det = Ray_DotF(&e1, &p);
+    float inverse, u, w, t;
+
+    /* A ray in the plane of the triangle, or a degenerate triangle. */
+    if (LA_ABS(det) < RAY_EPSILON)
+        return 0;
+
+    inverse = 1.0f / det;
+    u = Ray_DotF(&s, &p) * inverse;
+    w = Ray_DotF(direction, &q) * inverse;
+    t = Ray_DotF(&e2, &q) * inverse;
+    if (!(u >= 0.0f && w >= 0.0f && (u + w) <= 1.0f && t >= 0.0f && t < hit->t))
+        return 0;
+
+    hit->t = t;
+    hit->u = u;
+    hit->v = w;
+    return 1;
+}
+
+/**
+* @brief Intersect a ray with an axis-aligned box (slab test).
+* @param hit Nearest hit so far; updated with the entry distance if the box is closer than hit->t
+* @param origin Ray origin
+* @param direction Ray direction, need not be normalized
+* @param min Minimum corner of the box
+* @param max Maximum corner of the box
+* @return int32_t 1 if hit was updated, otherwise 0
+**/
+int32_t LibAxis_Ray_AABB(RayHit* hit, Vec3f* origin, Vec3f* direction, Vec3f* min, Vec3f* max) {
+    float ix = 1.0f / direction->x;
+    float iy = 1.0f / direction->y;
+    float iz = 1.0f / direction->z;
+    float x0 = (min->x - origin->x) * ix;
+    float x1 = (max->x - origin->x) * ix;
+    float y0 = (min->y - origin->y) * iy;
+    float y1 = (max->y - origin->y) * iy;
+    float z0 = (min->z - origin->z) * iz;
+    float z1 = (max->z - origin->z) * iz;
+    float t_near = LA_MAX3(LA_MIN2(x0, x1), LA_MIN2(y0, y1), LA_MIN2(z0, z1));
+    float t_far = LA_MIN3(LA_MAX2(x0, x1), LA_MAX2(y0, y1), LA_MAX2(z0, z1));
+
+    t_near = LA_MAX2(t_near, 0.0f);
+    if (!(t_near <= t_far && t_near < hit->t))
+        return 0;
+
+    hit->t = t_near;
+    hit->u = hit->v = 0.0f;
+    return 1;
+}
+
+/**
+* @brief Intersect a ray with a sphere.
+* @param hit Nearest hit so far; updated with the entry distance if the sphere is closer than hit->t
+* @param origin Ray origin
+* @param direction Ray direction, need not be normalized
+* @param center Sphere center
+* @param radius Sphere radius
+* @return int32_t 1 if hit was updated, otherwise 0
+**/
+int32_t LibAxis_Ray_Sphere(RayHit* hit, Vec3f* origin, Vec3f* direction, Vec3f* center, float radius) {
+    Vec3f oc = Ray_SubF(origin, center);
+    float a = Ray_DotF(direction, direction);
+    float b = Ray_DotF(&oc, direction);
+    float c = Ray_DotF(&oc, &oc) - (radius * radius);
+    float disc = (b * b) - (a * c);
+    float root, t_near, t_far;
+
+    if (!(disc >= 0.0f))
+        return 0;
+
+    root = LibAxis_SqrtF(disc);
+    t_near = (-b - root) / a;
+    t_far = (-b + root) / a;
+    t_near = LA_MAX2(t_near, 0.0f);
+    if (!(t_far >= 0.0f && t_near < hit->t))
+        return 0;
+
+    hit->t = t_near;
+    hit->u = hit->v = 0.0f;
+    return 1;
+}
+#endif
+
+/**
+* @brief Intersect a packet of rays with one triangle, LA_SIMD_WIDTH rays per iteration.
+* @param hits Nearest hits so far, origin->count rays; lanes that hit the triangle closer take index
+* @param origin Ray origins
+* @param direction Ray directions, same count as origin
+* @param v The three vertices of the triangle
+* @param index Primitive index recorded for the rays that hit
+* @return void
+**/
+void LA_KERNEL(LibAxis_Ray_TrianglePacket)(RayHitStream* hits, Vec3fStream* origin, Vec3fStream* direction, Vec3f* v, int32_t index) {
+    Vec3f e1 = VEC3F_NEW(v[1].x - v[0].x, v[1].y - v[0].y, v[1].z - v[0].z);
+    Vec3f e2 = VEC3F_NEW(v[2].x - v[0].x, v[2].y - v[0].y, v[2].z - v[0].z);
+    uint32_t count = origin->count;
+    uint32_t i;
+    LA_F32xN dx, dy, dz, sx, sy, sz, px, py, pz, qx, qy, qz;
+    LA_F32xN det, inverse, u, w, t;
+    LA_I32xN hit;
+
+    for (i = 0; i < count; i += LA_SIMD_WIDTH) {
+        dx = LA_LOADN(&direction->x[i]);
+        dy = LA_LOADN(&direction->y[i]);
+        dz = LA_LOADN(&direction->z[i]);
+        sx = LA_LOADN(&origin->x[i]) - v[0].x;
+        sy = LA_LOADN(&origin->y[i]) - v[0].y;
+        sz = LA_LOADN(&origin->z[i]) - v[0].z;
+
+        px = (dy * e2.z) - (e2.y * dz);
+        py = (dz * e2.x) - (e2.z * dx);
+        pz = (dx * e2.y) - (e2.x * dy);
+        qx = (sy * e1.z) - (e1.y * sz);
+        qy = (sz * e1.x) - (e1.z * sx);
+        qz = (sx * e1.y) - (e1.x * sy);
+
+        det = (e1.x * px) + (e1.y * py) + (e1.z * pz);
+        inverse = 1.0f / det;
+        u = ((sx * px) + (sy * py) + (sz * pz)) * inverse;
+        w = ((dx * qx) + (dy * qy) + (dz * qz)) * inverse;
+        t = ((e2.x * qx) + (e2.y * qy) + (e2.z * qz)) * inverse;
+
+        hit = ((det >= RAY_EPSILON) | (det <= -RAY_EPSILON)) & (u >= 0.0f) & (w >= 0.0f) & ((u + w) <= 1.0f) & (t >= 0.0f) & (t < LA_LOADN(&hits->t[i]));
+
+        /* A packet usually misses a given triangle entirely, which leaves nothing to store. */
+        if (LA_MaskBitsN(hit) != 0)
+            Ray_StoreN(hits, i, hit, t, u, w, index);
+    }
+}
+
+/**
+* @brief Intersect a packet of rays with one axis-aligned box, LA_SIMD_WIDTH rays per iteration.
+* @param hits Nearest hits so far, origin->count rays; lanes that enter the box closer take index
+* @param origin Ray origins
+* @param direction Ray directions, same count as origin
+* @param min Minimum corner of the box
+* @param max Maximum corner of the box
+* @param index Primitive index recorded for the rays that hit
+* @return void
+**/
+void LA_KERNEL(LibAxis_Ray_AABBPacket)(RayHitStream* hits, Vec3fStream* origin, Vec3fStream* direction, Vec3f* min, Vec3f* max, int32_t index) {
+    const LA_F32xN zero = {0.0f};
+    uint32_t count = origin->count;
+    uint32_t i;
+    LA_F32xN ox, oy, oz, ix, iy, iz, x0, x1, y0, y1, z0, z1, t_near, t_far;
+    LA_I32xN hit;
+
+    for (i = 0; i < count; i += LA_SIMD_WIDTH) {
+        ox = LA_LOADN(&origin->x[i]);
+        oy = LA_LOADN(&origin->y[i]);
+        oz = LA_LOADN(&origin->z[i]);
+        ix = 1.0f / LA_LOADN(&direction->x[i]);
+        iy = 1.0f / LA_LOADN(&direction->y[i]);
+        iz = 1.0f / LA_LOADN(&direction->z[i]);
+
+        x0 = (min->x - ox) * ix;
+        x1 = (max->x - ox) * ix;
+        y0 = (min->y - oy) * iy;
+        y1 = (max->y - oy) * iy;
+        z0 = (min->z - oz) * iz;
+        z1 = (max->z - oz) * iz;
+        t_near = Ray_MaxN(Ray_MinN(x0, x1), Ray_MaxN(Ray_MinN(y0, y1), Ray_MinN(z0, z1)));
+        t_far = Ray_MinN(Ray_MaxN(x0, x1), Ray_MinN(Ray_MaxN(y0, y1), Ray_MaxN(z0, z1)));
+        t_near = Ray_MaxN(t_near, zero);
+
+        hit = (t_near <= t_far) & (t_near < LA_LOADN(&hits->t[i]));
+        if (LA_MaskBitsN(hit) != 0)
+            Ray_StoreN(hits, i, hit, t_near, zero, zero, index);
+    }
+}
+
+/**
+* @brief Intersect a packet of rays with one sphere, LA_SIMD_WIDTH rays per iteration.
+* @param hits Nearest hits so far, origin->count rays; lanes that enter the sphere closer take index
+* @param origin Ray origins
+* @param direction Ray directions, same count as origin
+* @param center Sphere center
+* @param radius Sphere radius
+* @param index Primitive index recorded for the rays that hit
+* @return void
+**/
+void LA_KERNEL(LibAxis_Ray_SpherePacket)(RayHitStream* hits, Vec3fStream* origin, Vec3fStream* direction, Vec3f* center, float radius, int32_t index) {
+    const LA_F32xN zero = {0.0f};
+    uint32_t count = origin->count;
+    uint32_t i;
+    LA_F32xN dx, dy, dz, ox, oy, oz, a, b, c, disc, root, t_near, t_far;
+    LA_I32xN hit;
+
+    for (i = 0; i < count; i += LA_SIMD_WIDTH) {
+        dx = LA_LOADN(&direction->x[i]);
+        dy = LA_LOADN(&direction->y[i]);
+        dz = LA_LOADN(&direction->z[i]);
+        ox = LA_LOADN(&origin->x[i]) - center->x;
+        oy = LA_LOADN(&origin->y[i]) - center->y;
+        oz = LA_LOADN(&origin->z[i]) - center->z;
+
+        a = (dx * dx) + (dy * dy) + (dz * dz);
+        b = (ox * dx) + (oy * dy) + (oz * dz);
+        c = ((ox * ox) + (oy * oy) + (oz * oz)) - (radius * radius);
+        disc = (b * b) - (a * c);
+
+        /* Negative discriminants are misses; LA_SqrtN turns them into 0 rather than NaN. */
+        root = LA_SqrtN(disc, LA_SQRT_PRECISE);
+        t_near = Ray_MaxN((-b - root) / a, zero);
+        t_far = (-b + root) / a;
+
+        hit = (disc >= 0.0f) & (t_far >= 0.0f) & (t_near < LA_LOADN(&hits->t[i]));
+        if (LA_MaskBitsN(hit) != 0)
+            Ray_StoreN(hits, i, hit, t_near, zero, zero, index);
+    }
+}
@@ -0,0 +1,442 @@
+/**
+ * @file: stream.c
+ * @author: CrookedPoe (https://github.com/CrookedPoe)
+ * 
+ * @brief Structure-of-arrays vector streams for bulk arithmetic.
+**/
+
+#include "../include/libaxis.h"
+
+/*
+ * All kernels walk the planes LA_SIMD_WIDTH floats at a time and rely on the
+ * planes being padded to LA_STREAM_PAD(count), so the lanes past `count` are
+ * computed and written but never meaningful. The number of elements processed
+ * is always taken from lhs->count. The arithmetic kernels are built a second
+ * time for AVX2 by dispatch_avx2.c, which skips the layout helpers.
+ */
+
+/* Divide by the magnitude, leaving zero-length vectors at zero like Vec3f_NormalizeAssignment. */
+static inline LA_F32xN Stream_SafeDivideN(LA_F32xN v, LA_F32xN magnitude, LA_I32xN nonzero) {
+    const LA_F32xN zero = {0.0f};
+
+    return LA_SELECTN(nonzero, v / LA_SELECTN(nonzero, magnitude, zero + 1.0f), zero);
+}
+
+#ifndef LA_DISPATCH_VARIANT
+/**
+* @brief Point the planes of a Vec3fStream into a single buffer.
+* @param stream The stream to initialize
+* @param buffer At least VEC3F_STREAM_FLOATS(count) floats, ideally LA_STREAM_ALIGN aligned
+* @param count Number of vectors
+* @return void
+**/
+void Vec3fStream_Init(Vec3fStream* stream, float* buffer, uint32_t count) {
+    uint32_t pad = LA_STREAM_PAD(count);
+
+    stream->x = buffer;
+    stream->y = buffer + pad;
+    stream->z = buffer + (pad * 2);
+    stream->count = count;
+}
+
+/**
+* @brief Scatter an array of Vec3f into the planes of a Vec3fStream, zeroing the padding.
+* @param stream Destination stream (must already be initialized)
+* @param src Source array of stream->count vectors
+* @return void
+**/
+void Vec3fStream_FromVec3f(Vec3fStream* stream, Vec3f* src) {
+    uint32_t i;
+
+    for (i = 0; i < stream->count; i++) {
+        stream->x[i] = src[i].x;
+        stream->y[i] = src[i].y;
+        stream->z[i] = src[i].z;
+    }
+
+    for (; i < LA_STREAM_PAD(stream->count); i++) {
+        stream->x[i] = stream->y[i] = stream->z[i] = 0.0f;
+    }
+}
+
+/**
+* @brief Gather the planes of a Vec3fStream back into an array of Vec3f.
+* @param stream Source stream
+* @param dst Destination array of stream->count vectors
+* @return void
+**/
+void Vec3fStream_ToVec3f(Vec3fStream* stream, Vec3f* dst) {
+    uint32_t i;
+
+    for (i = 0; i < stream->count; i++) {
+        dst[i].x = stream->x[i];
+        dst[i].y = stream->y[i];
+        dst[i].z = stream->z[i];
+    }
+}
+#endif
+
+/**
+* @brief Adds every vector in rhs to the matching vector in lhs.
+* (Vec3f)out[i] = (Vec3f)lhs[i] + (Vec3f)rhs[i];
+* @param out Output stream (may be lhs or rhs)
+* @param lhs Left Hand Side
+* @param rhs Right Hand Side
+* @return void
+**/
+void LA_KERNEL(Vec3fStream_Add)(Vec3fStream* out, Vec3fStream* lhs, Vec3fStream* rhs) {
+    uint32_t i;
+
+    for (i = 0; i < lhs->count; i += LA_SIMD_WIDTH) {
+        LA_STOREN(&out->x[i], LA_LOADN(&lhs->x[i]) + LA_LOADN(&rhs->x[i]));
+        LA_STOREN(&out->y[i], LA_LOADN(&lhs->y[i]) + LA_LOADN(&rhs->y[i]));
+        LA_STOREN(&out->z[i], LA_LOADN(&lhs->z[i]) + LA_LOADN(&rhs->z[i]));
+    }
+}
+
+/**
+* @brief Subtracts every vector in rhs from the matching vector in lhs.
+* (Vec3f)out[i] = (Vec3f)lhs[i] - (Vec3f)rhs[i];
+* @param out Output stream (may be lhs or rhs)
+* @param lhs Left Hand Side
+* @param rhs Right Hand Side
+* @return void
+**/
+void LA_KERNEL(Vec3fStream_Sub)(Vec3fStream* out, Vec3fStream* lhs, Vec3fStream* rhs) {
+    uint32_t i;
+
+    for (i = 0; i < lhs->count; i += LA_SIMD_WIDTH) {
+        LA_STOREN(&out->x[i], LA_LOADN(&lhs->x[i]) - LA_LOADN(&rhs->x[i]));
+        LA_STOREN(&out->y[i], LA_LOADN(&lhs->y[i]) - LA_LOADN(&rhs->y[i]));
+        LA_STOREN(&out->z[i], LA_LOADN(&lhs->z[i]) - LA_LOADN(&rhs->z[i]));
+    }
+}
+
+/**
+* @brief Scales every vector in lhs by the matching vector in rhs.
+* (Vec3f)out[i] = (Vec3f)lhs[i] * (Vec3f)rhs[i];
+* @param out Output stream (may be lhs or rhs)
+* @param lhs Left Hand Side
+* @param rhs Right Hand Side
+* @return void
+**/
+void LA_KERNEL(Vec3fStream_Multiply)(Vec3fStream* out, Vec3fStream* lhs, Vec3fStream* rhs) {
+    uint32_t i;
+
+    for (i = 0; i < lhs->count; i += LA_SIMD_WIDTH) {
+        LA_STOREN(&out->x[i], LA_LOADN(&lhs->x[i]) * LA_LOADN(&rhs->x[i]));
+        LA_STOREN(&out->y[i], LA_LOADN(&lhs->y[i]) * LA_LOADN(&rhs->y[i]));
+        LA_STOREN(&out->z[i], LA_LOADN(&lhs->z[i]) * LA_LOADN(&rhs->z[i]));
+    }
+}
+
+/**
+* @brief Scales every vector in lhs by the float rhs.
+* (Vec3f)out[i] = (Vec3f)lhs[i] * (float)rhs;
+* @param out Output stream (may be lhs)
+* @param lhs Left Hand Side
+* @param rhs Right Hand Side
+* @return void
+**/
+void LA_KERNEL(Vec3fStream_MultiplyF)(Vec3fStream* out, Vec3fStream* lhs, float rhs) {
+    uint32_t i;
+
+    for (i = 0; i < lhs->count; i += LA_SIMD_WIDTH) {
+        LA_STOREN(&out->x[i], LA_LOADN(&lhs->x[i]) * rhs);
+        LA_STOREN(&out->y[i], LA_LOADN(&lhs->y[i]) * rhs);
+        LA_STOREN(&out->z[i], LA_LOADN(&lhs->z[i]) * rhs);
+    }
+}
+
+/**
+* @brief Computes the dot product of every pair of vectors.
+* (float)out[i] = (Vec3f)lhs[i] • (Vec3f)rhs[i];
+* @param out Array of at least LA_STREAM_PAD(lhs->count) floats
+* @param lhs Left Hand Side
+* @param rhs Right Hand Side
+* @return void
+**/
+void LA_KERNEL(Vec3fStream_Dot)(float* out, Vec3fStream* lhs, Vec3fStream* rhs) {
+    uint32_t i;
+
+    for (i = 0; i < lhs->count; i += LA_SIMD_WIDTH) {
+        LA_STOREN(&out[i],
+              (LA_LOADN(&lhs->x[i]) * LA_LOADN(&rhs->x[i]))
+            + (LA_LOADN(&lhs->y[i]) * LA_LOADN(&rhs->y[i]))
+            + (LA_LOADN(&lhs->z[i]) * LA_LOADN(&rhs->z[i])));
+    }
+}
+
+/**
+* @brief Computes the cross product of every pair of vectors.
+* (Vec3f)out[i] = (Vec3f)lhs[i] x (Vec3f)rhs[i];
+* @param out Output stream (may be lhs or rhs)
+* @param lhs Left Hand Side
+* @param rhs Right Hand Side
+* @return void
+**/
+void LA_KERNEL(Vec3fStream_Cross)(Vec3fStream* out, Vec3fStream* lhs, Vec3fStream* rhs) {
+    LA_F32xN lx, ly, lz, rx, ry, rz;
+    uint32_t i;
+
+    for (i = 0; i < lhs->count; i += LA_SIMD_WIDTH) {
+        lx = LA_LOADN(&lhs->x[i]);
+        ly = LA_LOADN(&lhs->y[i]);
+        lz = LA_LOADN(&lhs->z[i]);
+        rx = LA_LOADN(&rhs->x[i]);
+        ry = LA_LOADN(&rhs->y[i]);
+        rz = LA_LOADN(&rhs->z[i]);
+        LA_STOREN(&out->x[i], ly * rz - ry * lz);
+        LA_STOREN(&out->y[i], lz * rx - rz * lx);
+        LA_STOREN(&out->z[i], lx * ry - rx * ly);
+    }
+}
+
+/**
+* @brief Normalizes every vector in lhs into a unit vector. Zero-length vectors stay zero.
+* @param out Output stream (may be lhs)
+* @param lhs Left Hand Side
+* @return void
+**/
+void LA_KERNEL(Vec3fStream_Normalize)(Vec3fStream* out, Vec3fStream* lhs) {
+    LA_F32xN x, y, z, magnitude;
+    LA_I32xN nonzero;
+    uint32_t i;
+
+    for (i = 0; i < lhs->count; i += LA_SIMD_WIDTH) {
+        x = LA_LOADN(&lhs->x[i]);
+        y = LA_LOADN(&lhs->y[i]);
+        z = LA_LOADN(&lhs->z[i]);
+        magnitude = LA_SqrtN((x * x) + (y * y) + (z * z), LA_SQRT_PRECISE);
+        nonzero = (magnitude != 0.0f);
+        LA_STOREN(&out->x[i], Stream_SafeDivideN(x, magnitude, nonzero));
+        LA_STOREN(&out->y[i], Stream_SafeDivideN(y, magnitude, nonzero));
+        LA_STOREN(&out->z[i], Stream_SafeDivideN(z, magnitude, nonzero));
+    }
+}
+
+/**
+* @brief Linearly interpolates from every vector in lhs towards the matching vector in rhs.
+* (Vec3f)out[i] = (Vec3f)lhs[i] + ((Vec3f)rhs[i] - (Vec3f)lhs[i]) * (float)t;
+* @param out Output stream (may be lhs or rhs)
+* @param lhs Start (t = 0)
+* @param rhs End (t = 1)
+* @param t Interpolation factor
+* @return void
+**/
+void LA_KERNEL(Vec3fStream_Lerp)(Vec3fStream* out, Vec3fStream* lhs, Vec3fStream* rhs, float t) {
+    LA_F32xN a;
+    uint32_t i;
+
+    for (i = 0; i < lhs->count; i += LA_SIMD_WIDTH) {
+        a = LA_LOADN(&lhs->x[i]);
+        LA_STOREN(&out->x[i], a + (LA_LOADN(&rhs->x[i]) - a) * t);
+        a = LA_LOADN(&lhs->y[i]);
+        LA_STOREN(&out->y[i], a + (LA_LOADN(&rhs->y[i]) - a) * t);
+        a = LA_LOADN(&lhs->z[i]);
+        LA_STOREN(&out->z[i], a + (LA_LOADN(&rhs->z[i]) - a) * t);
+    }
+}
+
+#ifndef LA_DISPATCH_VARIANT
+/**
+* @brief Point the planes of a Vec4fStream into a single buffer.
+* @param stream The stream to initialize
+* @param buffer At least VEC4F_STREAM_FLOATS(count) floats, ideally LA_STREAM_ALIGN aligned
+* @param count Number of vectors
+* @return void
+**/
+void Vec4fStream_Init(Vec4fStream* stream, float* buffer, uint32_t count) {
+    uint32_t pad = LA_STREAM_PAD(count);
+
+    stream->x = buffer;
+    stream->y = buffer + pad;
+    stream->z = buffer + (pad * 2);
+    stream->w = buffer + (pad * 3);
+    stream->count = count;
+}
+
+/**
+* @brief Scatter an array of Vec4f into the planes of a Vec4fStream, zeroing the padding.
+* @param stream Destination stream (must already be initialized)
+* @param src Source array of stream->count vectors
+* @return void
+**/
+void Vec4fStream_FromVec4f(Vec4fStream* stream, Vec4f* src) {
+    uint32_t i;
+
+    for (i = 0; i < stream->count; i++) {
+        stream->x[i] = src[i].x;
+        stream->y[i] = src[i].y;
+        stream->z[i] = src[i].z;
+        stream->w[i] = src[i].w;
+    }
+
+    for (; i < LA_STREAM_PAD(stream->count); i++) {
+        stream->x[i] = stream->y[i] = stream->z[i] = stream->w[i] = 0.0f;
+    }
+}
+
+/**
+* @brief Gather the planes of a Vec4fStream back into an array of Vec4f.
+* @param stream Source stream
+* @param dst Destination array of stream->count vectors
+* @return void
+**/
+void Vec4fStream_ToVec4f(Vec4fStream* stream, Vec4f* dst) {
+    uint32_t i;
+
+    for (i = 0; i < stream->count; i++) {
+        dst[i].x = stream->x[i];
+        dst[i].y = stream->y[i];
+        dst[i].z = stream->z[i];
+        dst[i].w = stream->w[i];
+    }
+}
+#endif
+
+/**
+* @brief Adds every vector in rhs to the matching vector in lhs.
+* (Vec4f)out[i] = (Vec4f)lhs[i] + (Vec4f)rhs[i];
+* @param out Output stream (may be lhs or rhs)
+* @param lhs Left Hand Side
+* @param rhs Right Hand Side
+* @return void
+**/
+void LA_KERNEL(Vec4fStream_Add)(Vec4fStream* out, Vec4fStream* lhs, Vec4fStream* rhs) {
+    uint32_t i;
+
+    for (i = 0; i < lhs->count; i += LA_SIMD_WIDTH) {
+        LA_STOREN(&out->x[i], LA_LOADN(&lhs->x[i]) + LA_LOADN(&rhs->x[i]));
+        LA_STOREN(&out->y[i], LA_LOADN(&lhs->y[i]) + LA_LOADN(&rhs->y[i]));
+        LA_STOREN(&out->z[i], LA_LOADN(&lhs->z[i]) + LA_LOADN(&rhs->z[i]));
+        LA_STOREN(&out->w[i], LA_LOADN(&lhs->w[i]) + LA_LOADN(&rhs->w[i]));
+    }
+}
+
+/**
+* @brief Subtracts every vector in rhs from the matching vector in lhs.
+* (Vec4f)out[i] = (Vec4f)lhs[i] - (Vec4f)rhs[i];
+* @param out Output stream (may be lhs or rhs)
+* @param lhs Left Hand Side
+* @param rhs Right Hand Side
+* @return void
+**/
+void LA_KERNEL(Vec4fStream_Sub)(Vec4fStream* out, Vec4fStream* lhs, Vec4fStream* rhs) {
+    uint32_t i;
+
+    for (i = 0; i < lhs->count; i += LA_SIMD_WIDTH) {
+        LA_STOREN(&out->x[i], LA_LOADN(&lhs->x[i]) - LA_LOADN(&rhs->x[i]));
+        LA_STOREN(&out->y[i], LA_LOADN(&lhs->y[i]) - LA_LOADN(&rhs->y[i]));
+        LA_STOREN(&out->z[i], LA_LOADN(&lhs->z[i]) - LA_LOADN(&rhs->z[i]));
+        LA_STOREN(&out->w[i], LA_LOADN(&lhs->w[i]) - LA_LOADN(&rhs->w[i]));
+    }
+}
+
+/**
+* @brief Scales every vector in lhs by the matching vector in rhs.
+* (Vec4f)out[i] = (Vec4f)lhs[i] * (Vec4f)rhs[i];
+* @param out Output stream (may be lhs or rhs)
+* @param lhs Left Hand Side
+* @param rhs Right Hand Side
+* @return void
+**/
+void LA_KERNEL(Vec4fStream_Multiply)(Vec4fStream* out, Vec4fStream* lhs, Vec4fStream* rhs) {
+    uint32_t i;
+
+    for (i = 0; i < lhs->count; i += LA_SIMD_WIDTH) {
+        LA_STOREN(&out->x[i], LA_LOADN(&lhs->x[i]) * LA_LOADN(&rhs->x[i]));
+        LA_STOREN(&out->y[i], LA_LOADN(&lhs->y[i]) * LA_LOADN(&rhs->y[i]));
+        LA_STOREN(&out->z[i], LA_LOADN(&lhs->z[i]) * LA_LOADN(&rhs->z[i]));
+        LA_STOREN(&out->w[i], LA_LOADN(&lhs->w[i]) * LA_LOADN(&rhs->w[i]));
+    }
+}
+
+/**
+* @brief Scales every vector in lhs by the float rhs.
+* (Vec4f)out[i] = (Vec4f)lhs[i] * (float)rhs;
+* @param out Output stream (may be lhs)
+* @param lhs Left Hand Side
+* @param rhs Right Hand Side
+* @return void
+**/
+void LA_KERNEL(Vec4fStream_MultiplyF)(Vec4fStream* out, Vec4fStream* lhs, float rhs) {
+    uint32_t i;
+
+    for (i = 0; i < lhs->count; i += LA_SIMD_WIDTH) {
+        LA_STOREN(&out->x[i], LA_LOADN(&lhs->x[i]) * rhs);
+        LA_STOREN(&out->y[i], LA_LOADN(&lhs->y[i]) * rhs);
+        LA_STOREN(&out->z[i], LA_LOADN(&lhs->z[i]) * rhs);
+        LA_STOREN(&out->w[i], LA_LOADN(&lhs->w[i]) * rhs);
+    }
+}
+
+/**
+* @brief Computes the dot product of every pair of vectors.
+* (float)out[i] = (Vec4f)lhs[i] • (Vec4f)rhs[i];
+* @param out Array of at least LA_STREAM_PAD(lhs->count) floats
+* @param lhs Left Hand Side
+* @param rhs Right Hand Side
+* @return void
+**/
+void LA_KERNEL(Vec4fStream_Dot)(float* out, Vec4fStream* lhs, Vec4fStream* rhs) {
+    uint32_t i;
+
+    for (i = 0; i < lhs->count; i += LA_SIMD_WIDTH) {
+        LA_STOREN(&out[i],
+              (LA_LOADN(&lhs->x[i]) * LA_LOADN(&rhs->x[i]))
+            + (LA_LOADN(&lhs->y[i]) * LA_LOADN(&rhs->y[i]))
+            + (LA_LOADN(&lhs->z[i]) * LA_LOADN(&rhs->z[i]))
+            + (LA_LOADN(&lhs->w[i]) * LA_LOADN(&rhs->w[i])));
+    }
+}
+
+/**
+* @brief Normalizes every vector in lhs into a unit vector. Zero-length vectors stay zero.
+* @param out Output stream (may be lhs)
+* @param lhs Left Hand Side
+* @return void
+**/
+void LA_KERNEL(Vec4fStream_Normalize)(Vec4fStream* out, Vec4fStream* lhs) {
+    LA_F32xN x, y, z, w, magnitude;
+    LA_I32xN nonzero;
+    uint32_t i;
+
+    for (i = 0; i < lhs->count; i += LA_SIMD_WIDTH) {
+        x = LA_LOADN(&lhs->x[i]);
+        y = LA_LOADN(&lhs->y[i]);
+        z = LA_LOADN(&lhs->z[i]);
+        w = LA_LOADN(&lhs->w[i]);
+        magnitude = LA_SqrtN((x * x) + (y * y) + (z * z) + (w * w), LA_SQRT_PRECISE);
+        nonzero = (magnitude != 0.0f);
+        LA_STOREN(&out->x[i], Stream_SafeDivideN(x, magnitude, nonzero));
+        LA_STOREN(&out->y[i], Stream_SafeDivideN(y, magnitude, nonzero));
+        LA_STOREN(&out->z[i], Stream_SafeDivideN(z, magnitude, nonzero));
+        LA_STOREN(&out->w[i], Stream_SafeDivideN(w, magnitude, nonzero));
+    }
+}
+
+/**
+* @brief Linearly interpolates from every vector in lhs towards the matching vector in rhs.
+* (Vec4f)out[i] = (Vec4f)lhs[i] + ((Vec4f)rhs[i] - (Vec4f)lhs[i]) * (float)t;
+* @param out Output stream (may be lhs or rhs)
+* @param lhs Start (t = 0)
+* @param rhs End (t = 1)
+* @param t Interpolation factor
+* @return void
+**/
+void LA_KERNEL(Vec4fStream_Lerp)(Vec4fStream* out, Vec4fStream* lhs, Vec4fStream* rhs, float t) {
+    LA_F32xN a;
+    uint32_t i;
+
+    for (i = 0; i < lhs->count; i += LA_SIMD_WIDTH) {
+        a = LA_LOADN(&lhs->x[i]);
+        LA_STOREN(&out->x[i], a + (LA_LOADN(&rhs->x[i]) - a) * t);
+        a = LA_LOADN(&lhs->y[i]);
+        LA_STOREN(&out->y[i], a + (LA_LOADN(&rhs->y[i]) - a) * t);
+        a = LA_LOADN(&lhs->z[i]);
+        LA_STOREN(&out->z[i], a + (LA_LOADN(&rhs->z[i]) - a) * t);
+        a = LA_LOADN(&lhs->w[i]);
+        LA_STOREN(&out->w[i], a + (LA_LOADN(&rhs->w[i]) - a) * t);
+    }
+}
\ No newline at end of file
@@ -0,0 +1,326 @@
+/**
+ * @file: texture.c
+ * @author: CrookedPoe (https://github.com/CrookedPoe)
+ *
+ * @brief Texture format conversion.
+**/
+
+#include "../include/libaxis.h"
+
+/*
+ * Every conversion goes through Color_RGBA32: a row is decoded in chunks of
+ * TEXTURE_CHUNK texels into a scratch buffer and encoded from there. Going
+ * from or to RGBA32 skips the scratch buffer. Channels are widened with bit
+ * replication and narrowed with q = (v * max + t) / 255, where t is 127
+ * (round to nearest) or a 4x4 Bayer threshold when dithering.
+ */
+#define TEXTURE_CHUNK 256 /* a multiple of 8, so chunks of 4-bit rows start on a byte */
+
+static const uint8_t Texture_Bits[LA_TEXFMT_COUNT] = {32, 24, 16, 16, 8, 4, 8, 4};
+
+static const int32_t Texture_Bayer4[4][4] = {
+    { 0,  8,  2, 10},
+    {12,  4, 14,  6},
+    { 3, 11,  1,  9},
+    {15,  7, 13,  5}
+};
+
+/* Exact floor(x / 255) for 0 <= x < 65535. */
+static inline int32_t Texture_Div255(int32_t x) {
+    return (x + 1 + (x >> 8)) >> 8;
+}
+
+static inline int32_t Texture_Quantize(int32_t v, int32_t max, int32_t t) {
+    return Texture_Div255((v * max) + t);
+}
+
+/* BT.601 luma in 8-bit fixed point. */
+static inline int32_t Texture_Intensity(Color_RGBA32 c) {
+    return ((c.r * 77) + (c.g * 150) + (c.b * 29) + 128) >> 8;
+}
+
+static inline Color_RGBA32 Texture_Gray(int32_t i, int32_t a) {
+    Color_RGBA32 c;
+
+    c.r = i;
+    c.g = i;
+    c.b = i;
+    c.a = a;
+
+    return c;
+}
+
+static inline uint32_t Texture_RowSize(int32_t format, uint32_t width) {
+    return ((width * Texture_Bits[format]) + 7) >> 3;
+}
+
+#if (LA_SIMD != LA_SIMD_SCALAR)
+LA_INLINE LA_I32xN Texture_QuantizeN(LA_I32xN v, int32_t max, LA_I32xN t) {
+    LA_I32xN x = (v * max) + t;
+
+    return (x + 1 + (x >> 8)) >> 8;
+}
+
+/* Swap native uint16_t lanes to and from the big-endian texture layout. */
+LA_INLINE LA_I32xN Texture_Swap16N(LA_I32xN v) {
+#if (__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__)
+    return ((v >> 8) & 0xFF) | ((v & 0xFF) << 8);
+#else
+    return v;
+#endif
+}
+#endif
+
+static void Texture_DecodeRGBA16(Color_RGBA32* out, uint8_t* src, uint32_t count) {
+    uint32_t i = 0, v;
+
+#if (LA_SIMD != LA_SIMD_SCALAR)
+    LA_I32xN w, r, g, b, a;
+
+    for (; (i + LA_SIMD_WIDTH) <= count; i += LA_SIMD_WIDTH) {
+        w = Texture_Swap16N(__builtin_convertvector(*(const LA_I16xNu*)&src[i * 2], LA_I32xN) & 0xFFFF);
+        r = (w >> 11) & 0x1F;
+        g = (w >> 6) & 0x1F;
+        b = (w >> 1) & 0x1F;
+        a = -(w & 0x1) & 0xFF;
+        LA_STORENI(&out[i], (((r << 3) | (r >> 2)) << LA_RGBA32_SHIFT_R)
+                          | (((g << 3) | (g >> 2)) << LA_RGBA32_SHIFT_G)
+                          | (((b << 3) | (b >> 2)) << LA_RGBA32_SHIFT_B)
+                          | (a << LA_RGBA32_SHIFT_A));
+    }
+#endif
+    for (; i < count; i++) {
+        v = (src[i * 2] << 8) | src[(i * 2) + 1];
+        out[i].r = COLOR_EXPAND5(v >> 11);
+        out[i].g = COLOR_EXPAND5(v >> 6);
+        out[i].b = COLOR_EXPAND5(v >> 1);
+        out[i].a = COLOR_EXPAND1(v);
+    }
+}
+
+static void Texture_EncodeRGBA16(uint8_t* dst, Color_RGBA32* in, uint32_t count, const int32_t t[4]) {
+    uint32_t i = 0, v;
+
+#if (LA_SIMD != LA_SIMD_SCALAR)
+    LA_I32xN px, w, tv = {0};
+    int32_t lane;
+
+    /* Chunks start on a multiple of 4 texels, so lane n always lands on column n & 3. */
+    for (lane = 0; lane < LA_SIMD_WIDTH; lane++)
+        tv[lane] = t[lane & 3];
+
+    for (; (i + LA_SIMD_WIDTH) <= count; i += LA_SIMD_WIDTH) {
+        px = LA_LOADNI(&in[i]);
+        w = (Texture_QuantizeN((px >> LA_RGBA32_SHIFT_R) & 0xFF, 31, tv) << 11)
+          | (Texture_QuantizeN((px >> LA_RGBA32_SHIFT_G) & 0xFF, 31, tv) << 6)
+          | (Texture_QuantizeN((px >> LA_RGBA32_SHIFT_B) & 0xFF, 31, tv) << 1)
+          | Texture_QuantizeN((px >> LA_RGBA32_SHIFT_A) & 0xFF, 1, tv);
+        *(LA_I16xNu*)&dst[i * 2] = __builtin_convertvector(Texture_Swap16N(w), LA_I16xN);
+    }
+#endif
+    for (; i < count; i++) {
+        v = (Texture_Quantize(in[i].r, 31, t[i & 3]) << 11)
+          | (Texture_Quantize(in[i].g, 31, t[i & 3]) << 6)
+          | (Texture_Quantize(in[i].b, 31, t[i & 3]) << 1)
+          | Texture_Quantize(in[i].a, 1, t[i & 3]);
+        dst[i * 2] = v >> 8;
+        dst[(i * 2) + 1] = v;
+    }
+}
+
+static void Texture_DecodeRGB24(Color_RGBA32* out, uint8_t* src, uint32_t count) {
+    uint32_t i = 0;
+
+#if (LA_SIMD != LA_SIMD_SCALAR)
+    const LA_U8x16 alpha = {255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255};
+    const LA_U8x16 lanes = {0, 1, 2, 16, 3, 4, 5, 16, 6, 7, 8, 16, 9, 10, 11, 16};
+
+    /* Four texels per shuffle; the 16-byte load reads 4 bytes ahead, so stop 2 texels early. */
+    for (; (i + 6) <= count; i += 4)
+        *(LA_U8x16u*)&out[i] = __builtin_shuffle((LA_U8x16)*(const LA_U8x16u*)&src[i * 3], alpha, lanes);
+#endif
+    for (; i < count; i++) {
+        out[i].r = src[i * 3];
+        out[i].g = src[(i * 3) + 1];
+        out[i].b = src[(i * 3) + 2];
+        out[i].a = 255;
+    }
+}
+
+static void Texture_EncodeRGB24(uint8_t* dst, Color_RGBA32* in, uint32_t count) {
+    uint32_t i = 0;
+
+#if (LA_SIMD != LA_SIMD_SCALAR)
+    const LA_U8x16 lanes = {0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14, 0, 0, 0, 0};
+
+    /* The 16-byte store spills 4 bytes into the next texels, which are written afterwards. */
+    for (; (i + 6) <= count; i += 4)
+        *(LA_U8x16u*)&dst[i * 3] = __builtin_shuffle((LA_U8x16)*(const LA_U8x16u*)&in[i], lanes);
+#endif
+    for (; i < count; i++) {
+        dst[i * 3] = in[i].r;
+        dst[(i * 3) + 1] = in[i].g;
+        dst[(i * 3) + 2] = in[i].b;
+    }
+}
+
+/* Decode count texels starting at column x of a row into RGBA32. */
+static void Texture_DecodeRow(Color_RGBA32* out, uint8_t* row, int32_t format, uint32_t x, uint32_t count) {
+    uint8_t* src = row + ((x * Texture_Bits[format]) >> 3);
+    uint32_t i, v;
+
+    switch (format) {
+        case LA_TEXFMT_RGBA32:
+            for (i = 0; i < count; i++)
+                out[i] = ((Color_RGBA32*)src)[i];
+            break;
+        case LA_TEXFMT_RGB24:
+            Texture_DecodeRGB24(out, src, count);
+            break;
+        case LA_TEXFMT_RGBA16:
+            Texture_DecodeRGBA16(out, src, count);
+            break;
+        case LA_TEXFMT_IA16:
+            for (i = 0; i < count; i++)
+                out[i] = Texture_Gray(src[i * 2], src[(i * 2) + 1]);
+            break;
+        case LA_TEXFMT_IA8:
+            for (i = 0; i < count; i++)
+                out[i] = Texture_Gray(COLOR_EXPAND4(src[i] >> 4), COLOR_EXPAND4(src[i]));
+            break;
+        case LA_TEXFMT_IA4:
+            for (i = 0; i < count; i++) {
+                v = (i & 1) ? src[i >> 1] : (src[i >> 1] >> 4);
+                out[i] = Texture_Gray(COLOR_EXPAND3(v >> 1), COLOR_EXPAND1(v));
+            }
+            break;
+        case LA_TEXFMT_I8:
+            for (i = 0; i < count; i++)
+                out[i] = Texture_Gray(src[i], src[i]);
+            break;
+        case LA_TEXFMT_I4:
+            for (i = 0; i < count; i++) {
+                v = COLOR_EXPAND4((i & 1) ? src[i >> 1] : (src[i >> 1] >> 4));
+                out[i] = Texture_Gray(v, v);
+            }
+            break;
+    }
+}
+
+/* Encode count RGBA32 texels into a row starting at column x, using the dither thresholds t of this row. */
+static void Texture_EncodeRow(uint8_t* row, int32_t format, Color_RGBA32* in, uint32_t x, uint32_t count, const int32_t t[4]) {
+    uint8_t* dst = row + ((x * Texture_Bits[format]) >> 3);
+    uint32_t i, v;
+
+    switch (format) {
+        case LA_TEXFMT_RGBA32:
+            for (i = 0; i < count; i++)
+                ((Color_RGBA32*)dst)[i] = in[i];
+            break;
+        case LA_TEXFMT_RGB24:
+            Texture_EncodeRGB24(dst, in, count);
+            break;
+        case LA_TEXFMT_RGBA16:
+            Texture_EncodeRGBA16(dst, in, count, t);
+            break;
+        case LA_TEXFMT_IA16:
+            for (i = 0; i < count; i++) {
+                dst[i * 2] = Texture_Intensity(in[i]);
+                dst[(i * 2) + 1] = in[i].a;
+            }
+            break;
+        case LA_TEXFMT_IA8:
+            for (i = 0; i < count; i++)
+                dst[i] = (Texture_Quantize(Texture_Intensity(in[i]), 15, t[i & 3]) << 4) | Texture_Quantize(in[i].a, 15, t[i & 3]);
+            break;
+        case LA_TEXFMT_IA4:
+            for (i = 0; i < count; i++) {
+                v = (Texture_Quantize(Texture_Intensity(in[i]), 7, t[i & 3]) << 1) | Texture_Quantize(in[i].a, 1, t[i & 3]);
+                dst[i >> 1] = (i & 1) ? ((dst[i >> 1] & 0xF0) | v) : (v << 4);
+            }
+            break;
+        case LA_TEXFMT_I8:
+            for (i = 0; i < count; i++)
+                dst[i] = Texture_Intensity(in[i]);
+            break;
+        case LA_TEXFMT_I4:
+            for (i = 0; i < count; i++) {
+                v = Texture_Quantize(Texture_Intensity(in[i]), 15, t[i & 3]);
+                dst[i >> 1] = (i & 1) ? ((dst[i >> 1] & 0xF0) | v) : (v << 4);
+            }
+            break;
+    }
+}
+
+/**
+* @brief Get the number of bytes a texture occupies in a given format.
+* @param format One of the LA_TEXFMT_* formats
+* @param width Width in texels
+* @param height Height in texels
+* @return The size in bytes, or 0 for an unknown format
+**/
+uint32_t LibAxis_Texture_Size(int32_t format, uint32_t width, uint32_t height) {
+    if (format < 0 || format >= LA_TEXFMT_COUNT)
+        return 0;
+
+    return Texture_RowSize(format, width) * height;
+}
+
+/**
+* @brief Convert a texture between two LA_TEXFMT_* formats (see texture.h for the layouts).
+* Narrowed channels are rounded to nearest, or ordered-dithered with LA_TEXTURE_DITHER;
+* widened channels are bit-replicated, so 5-bit 31 becomes 255. Intensity is computed
+* from RGB with BT.601 weights.
+* @param dst Destination texels, LibAxis_Texture_Size(dst_format, width, height) bytes
+* @param dst_format Destination format
+* @param src Source texels (must not overlap dst)
+* @param src_format Source format
+* @param width Width in texels
+* @param height Height in texels
+* @param flags LA_TEXTURE_* flags
+* @return 1 on success, 0 if either format is unknown
+**/
+int32_t LibAxis_Texture_Convert(void* dst, int32_t dst_format, void* src, int32_t src_format, uint32_t width, uint32_t height, int32_t flags) {
+    Color_RGBA32 scratch[TEXTURE_CHUNK];
+    Color_RGBA32* texels;
+    int32_t t[4];
+    uint8_t* src_row;
+    uint8_t* dst_row;
+    uint32_t src_stride, dst_stride;
+    uint32_t x, y, n;
+    int32_t i;
+
+    if (dst_format < 0 || dst_format >= LA_TEXFMT_COUNT || src_format < 0 || src_format >= LA_TEXFMT_COUNT)
+        return 0;
+
+    src_stride = Texture_RowSize(src_format, width);
+    dst_stride = Texture_RowSize(dst_format, width);
+
+    for (y = 0; y < height; y++) {
+        src_row = (uint8_t*)src + (y * src_stride);
+        dst_row = (uint8_t*)dst + (y * dst_stride);
+
+        for (i = 0; i < 4; i++)
+            t[i] = (flags & LA_TEXTURE_DITHER) ? ((((Texture_Bayer4[y & 3][i] * 2) + 1) * 255) >> 5) : 127;
+
+        for (x = 0; x < width; x += TEXTURE_CHUNK) {
+            n = LA_MIN2(TEXTURE_CHUNK, width - x);
+
+            if (dst_format == LA_TEXFMT_RGBA32) {
+                Texture_DecodeRow((Color_RGBA32*)dst_row + x, src_row, src_format, x, n);
+                continue;
+            }
+
+            if (src_format == LA_TEXFMT_RGBA32) {
+                texels = (Color_RGBA32*)src_row + x;
+            } else {
+                Texture_DecodeRow(scratch, src_row, src_format, x, n);
+                texels = scratch;
+            }
+
+            Texture_EncodeRow(dst_row, dst_format, texels, x, n, t);
+        }
+    }
+
+    return 1;
+}
\ No newline at end of file
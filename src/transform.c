@@ -0,0 +1,149 @@
+/**
+ * @file: transform.c
+ * @author: CrookedPoe (https://github.com/CrookedPoe)
+ *
+ * @brief Flat transform hierarchy with incremental world matrix updates.
+**/
+
+#include "../include/libaxis.h"
+
+static void Transform_CopyF(float dst[4][4], float src[4][4]) {
+    int32_t r, c;
+
+    for (r = 0; r < 4; r++) {
+        for (c = 0; c < 4; c++)
+            dst[r][c] = src[r][c];
+    }
+}
+
+/* Rebuild the world matrices of nodes [first, end), parents before children. */
+static void Transform_UpdateRangeF(TransformTree* tree, int32_t first, int32_t end) {
+    int32_t i = first;
+    int32_t parent, run;
+
+    while (i < end) {
+        /* Consecutive siblings share one parent matrix, so they go through the array kernel together. */
+        parent = tree->parent[i];
+        for (run = 1; (i + run < end) && (tree->parent[i + run] == parent); run++);
+
+        if (parent == LA_TRANSFORM_NONE) {
+            for (; run > 0; run--, i++)
+                Transform_CopyF(tree->world[i], tree->local[i]);
+        }
+        else {
+            LibAxis_Matrix44_PostMultiplyArrayF(&tree->local[i], tree->world[parent], &tree->world[i], (uint32_t)run);
+            i += run;
+        }
+    }
+}
+
+/**
+* @brief Point the arrays of a TransformTree into a single buffer and empty it.
+* @param tree The tree to initialize
+* @param buffer At least LA_TRANSFORM_BYTES(capacity) bytes, ideally 16 byte aligned
+* @param capacity Maximum number of nodes
+* @return void
+**/
+void LibAxis_Transform_Init(TransformTree* tree, void* buffer, uint32_t capacity) {
+    uint8_t* bytes = (uint8_t*)buffer;
+
+    tree->local = (float (*)[4][4])bytes;
+    tree->world = (float (*)[4][4])(bytes + (capacity * sizeof(float) * 16));
+    tree->parent = (int32_t*)(bytes + (capacity * sizeof(float) * 32));
+    tree->subtree_end = tree->parent + capacity;
+    tree->dirty = (uint8_t*)(tree->subtree_end + capacity);
+    tree->count = 0;
+    tree->capacity = capacity;
+    tree->dirty_count = 0;
+    tree->dirty_first = 0;
+}
+
+/**
+* @brief Append a node under parent. Its world matrix is built by the next update.
+* @param tree The tree
+* @param parent LA_TRANSFORM_NONE for a root, otherwise the last node or one of its ancestors
+* @param local Local matrix, relative to the parent
+* @return int32_t Index of the new node, or LA_TRANSFORM_NONE if the tree is full or parent would break pre-order
+**/
+int32_t LibAxis_Transform_Add(TransformTree* tree, int32_t parent, float local[4][4]) {
+    int32_t node = (int32_t)tree->count;
+    int32_t i;
+
+    if (tree->count >= tree->capacity)
+        return LA_TRANSFORM_NONE;
+
+    if (parent != LA_TRANSFORM_NONE && (parent < 0 || parent >= node || tree->subtree_end[parent] != node))
+        return LA_TRANSFORM_NONE;
+
+    Transform_CopyF(tree->local[node], local);
+    tree->parent[node] = parent;
+    tree->subtree_end[node] = node + 1;
+    tree->dirty[node] = 0;
+    tree->count++;
+    LibAxis_Transform_MarkDirty(tree, node);
+
+    for (i = parent; i != LA_TRANSFORM_NONE; i = tree->parent[i])
+        tree->subtree_end[i] = node + 1;
+
+    return node;
+}
+
+/**
+* @brief Replace the local matrix of a node and mark its subtree for update.
+* @param tree The tree
+* @param node Node index
+* @param local New local matrix
+* @return void
+**/
+void LibAxis_Transform_SetLocal(TransformTree* tree, int32_t node, float local[4][4]) {
+    Transform_CopyF(tree->local[node], local);
+    LibAxis_Transform_MarkDirty(tree, node);
+}
+
+/**
+* @brief Mark a node whose local matrix was edited in place, so its subtree is rebuilt by the next update.
+* @param tree The tree
+* @param node Node index
+* @return void
+**/
+void LibAxis_Transform_MarkDirty(TransformTree* tree, int32_t node) {
+    if (!tree->dirty[node]) {
+        tree->dirty[node] = 1;
+        tree->dirty_count++;
+    }
+
+    if ((uint32_t)node < tree->dirty_first)
+        tree->dirty_first = (uint32_t)node;
+}
+
+/**
+* @brief Rebuild the world matrices of every dirty node and its descendants.
+* @param tree The tree
+* @return uint32_t Number of world matrices rebuilt
+**/
+uint32_t LibAxis_Transform_Update(TransformTree* tree) {
+    int32_t count = (int32_t)tree->count;
+    int32_t i, j, end;
+    uint32_t rebuilt = 0;
+
+    for (i = (int32_t)tree->dirty_first; (i < count) && (tree->dirty_count > 0); i++) {
+        if (!tree->dirty[i])
+            continue;
+
+        /* Dirty descendants are covered by this range; clear them as well. */
+        end = tree->subtree_end[i];
+        for (j = i; j < end; j++) {
+            if (tree->dirty[j]) {
+                tree->dirty[j] = 0;
+                tree->dirty_count--;
+            }
+        }
+
+        Transform_UpdateRangeF(tree, i, end);
+        rebuilt += (uint32_t)(end - i);
+        i = end - 1;
+    }
+
+    tree->dirty_first = tree->count;
+    return rebuilt;
+}
\ No newline at end of file